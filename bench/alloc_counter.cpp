@@ -0,0 +1,100 @@
+#include "alloc_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Every allocation gets a header in front of it that remembers its size, so the live byte count can be kept up to
+// date in operator delete without relying on sized deallocation
+namespace
+{
+
+std::atomic<size_t> allocations{0};
+std::atomic<size_t> allocated_bytes{0};
+std::atomic<size_t> live_bytes{0};
+std::atomic<size_t> peak_live_bytes{0};
+std::atomic<size_t> peak_base{0};
+
+constexpr size_t header_size = alignof(std::max_align_t);
+
+void record(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    size_t live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    size_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while(live > peak && peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed) == false) {
+    }
+}
+
+void* counted_alloc(size_t size, size_t alignment)
+{
+    size_t header = alignment > header_size ? alignment : header_size;
+    void* block = nullptr;
+    if(alignment > header_size)
+        block = std::aligned_alloc(alignment, (header + size + alignment - 1) / alignment * alignment);
+    else
+        block = std::malloc(header + size);
+    if(block == nullptr)
+        return nullptr;
+    record(size);
+    auto user = static_cast<std::byte*>(block) + header;
+    reinterpret_cast<size_t*>(user)[-1] = size;
+    return user;
+}
+
+void counted_free(void* ptr, size_t alignment)
+{
+    if(ptr == nullptr)
+        return;
+    size_t header = alignment > header_size ? alignment : header_size;
+    size_t size = reinterpret_cast<size_t*>(ptr)[-1];
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    std::free(static_cast<std::byte*>(ptr) - header);
+}
+
+void* throwing_alloc(size_t size, size_t alignment)
+{
+    void* ptr = counted_alloc(size, alignment);
+    if(ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+}
+
+nanoizepp::bench::AllocStats nanoizepp::bench::alloc_stats()
+{
+    AllocStats stats;
+    stats.allocations = allocations.load();
+    stats.allocated_bytes = allocated_bytes.load();
+    size_t peak = peak_live_bytes.load();
+    size_t base = peak_base.load();
+    stats.peak_bytes = peak > base ? peak - base : 0;
+    return stats;
+}
+
+void nanoizepp::bench::reset_peak()
+{
+    size_t live = live_bytes.load();
+    peak_base.store(live);
+    peak_live_bytes.store(live);
+}
+
+void* operator new(size_t size) { return throwing_alloc(size, 0); }
+void* operator new[](size_t size) { return throwing_alloc(size, 0); }
+void* operator new(size_t size, std::align_val_t alignment) { return throwing_alloc(size, size_t(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return throwing_alloc(size, size_t(alignment)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return counted_alloc(size, 0); }
+
+void operator delete(void* ptr) noexcept { counted_free(ptr, 0); }
+void operator delete[](void* ptr) noexcept { counted_free(ptr, 0); }
+void operator delete(void* ptr, size_t) noexcept { counted_free(ptr, 0); }
+void operator delete[](void* ptr, size_t) noexcept { counted_free(ptr, 0); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { counted_free(ptr, size_t(alignment)); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept { counted_free(ptr, size_t(alignment)); }
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept { counted_free(ptr, size_t(alignment)); }
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept { counted_free(ptr, size_t(alignment)); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { counted_free(ptr, 0); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { counted_free(ptr, 0); }
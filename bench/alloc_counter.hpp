@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+namespace nanoizepp::bench
+{
+
+/**
+ * @brief Heap usage recorded by the replaced global operator new/delete (see alloc_counter.cpp)
+*/
+struct AllocStats
+{
+    size_t allocations = 0;
+    size_t allocated_bytes = 0;
+    // Highest number of live bytes since the last reset_peak(), relative to the live bytes at that time
+    size_t peak_bytes = 0;
+};
+
+AllocStats alloc_stats();
+
+/**
+ * @brief Restart the peak tracking from the current live heap size
+*/
+void reset_peak();
+
+}
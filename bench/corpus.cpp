@@ -0,0 +1,273 @@
+#include "corpus.hpp"
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp::bench;
+
+static constexpr std::string_view words[] = {
+    "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do", "eiusmod", "tempor",
+    "incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam", "quis",
+    "nostrud", "exercitation", "ullamco", "laboris", "nisi", "aliquip", "ex", "ea", "commodo", "consequat",
+    "the", "a", "of", "and", "to", "in", "is", "that", "for", "it", "with", "as", "was", "on", "compiler",
+    "template", "allocation", "benchmark", "latency", "throughput", "&amp;", "&lt;tag&gt;", "caf\xC3\xA9",
+};
+
+static constexpr std::string_view inline_tags[] = {"em", "strong", "code", "a", "span", "b", "i", "kbd"};
+
+static void append(std::string& out, std::initializer_list<std::string_view> parts)
+{
+    for(auto part : parts)
+        out += part;
+}
+
+static std::string_view pick_word(Random& random)
+{
+    return words[random.below(std::size(words))];
+}
+
+static void append_indent(std::string& out, size_t depth)
+{
+    out.append(depth * 4, ' ');
+}
+
+/**
+ * @brief Append a paragraph of words with the occasional inline element and hard line break, like hand written
+ * or templated prose
+*/
+static void append_sentences(std::string& out, Random& random, size_t word_count, size_t depth)
+{
+    for(size_t i = 0; i < word_count; i++) {
+        if(i != 0 && random.chance(8)) {
+            out += '\n';
+            append_indent(out, depth);
+        }
+        else if(i != 0) {
+            out += ' ';
+        }
+        if(random.chance(6)) {
+            auto tag = inline_tags[random.below(std::size(inline_tags))];
+            out += '<';
+            out += tag;
+            if(tag == "a")
+                append(out, {" href=\"https://example.com/posts/", std::to_string(random.below(10000)), "\""});
+            out += '>';
+            out += pick_word(random);
+            out += "</";
+            out += tag;
+            out += '>';
+        }
+        else {
+            out += pick_word(random);
+        }
+        if(random.chance(10))
+            out += random.chance(70) ? "." : ",";
+    }
+}
+
+static void append_head(std::string& out, Random& random, std::string_view title)
+{
+    out += "<!DOCTYPE html>\n<html lang=\"en\">\n<head>\n";
+    out += "    <meta charset=\"utf-8\">\n";
+    out += "    <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\n";
+    out += "    <title>";
+    out += title;
+    out += "</title>\n";
+    for(size_t i = 0, n = 2 + random.below(4); i < n; i++)
+        append(out, {"    <link rel=\"stylesheet\" href=\"/static/css/style-", std::to_string(i), ".css\">\n"});
+    out += "</head>\n";
+}
+
+std::string nanoizepp::bench::generate_blog(size_t size, uint64_t seed)
+{
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    append_head(out, random, "A blog");
+    out += "<body>\n    <nav class=\"site-nav\">\n        <ul>\n";
+    for(int i = 0; i < 8; i++)
+        append(out, {"            <li><a href=\"/section/", std::to_string(i), "\">Section ", std::to_string(i), "</a></li>\n"});
+    out += "        </ul>\n    </nav>\n    <main>\n";
+    while(out.size() < size) {
+        append(out, {"        <article class=\"post\" id=\"post-", std::to_string(random.below(100000)), "\">\n"});
+        out += "            <h2>";
+        append_sentences(out, random, 3 + random.below(6), 3);
+        out += "</h2>\n";
+        out += "            <p class=\"meta\">Posted on <time datetime=\"2023-01-01\">January 1st</time></p>\n";
+        for(size_t p = 0, n = 2 + random.below(6); p < n; p++) {
+            out += "            <p>\n                ";
+            append_sentences(out, random, 30 + random.below(90), 4);
+            out += "\n            </p>\n";
+            if(random.chance(20))
+                append(out, {"            <img src=\"/img/", std::to_string(random.below(1000)), ".png\" alt=\"figure\">\n"});
+            if(random.chance(10)) {
+                out += "            <pre><code>int main()\n{\n    return 0;\n}\n</code></pre>\n";
+            }
+        }
+        out += "        </article>\n";
+    }
+    out += "    </main>\n    <footer><p>Copyright</p></footer>\n</body>\n</html>\n";
+    return out;
+}
+
+std::string nanoizepp::bench::generate_table(size_t size, uint64_t seed)
+{
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    append_head(out, random, "Report");
+    out += "<body>\n<table class=\"report\">\n    <thead>\n        <tr>";
+    const size_t columns = 8;
+    for(size_t c = 0; c < columns; c++)
+        append(out, {"<th scope=\"col\">Column ", std::to_string(c), "</th>"});
+    out += "</tr>\n    </thead>\n    <tbody>\n";
+    while(out.size() < size) {
+        append(out, {"        <tr class=\"", random.chance(50) ? "odd" : "even", "\">\n"});
+        for(size_t c = 0; c < columns; c++) {
+            out += "            <td>";
+            if(c == 0)
+                out += pick_word(random);
+            else
+                out += std::to_string(random.below(1000000));
+            // Some generators leave cells unclosed
+            if(random.chance(95))
+                out += "</td>";
+            out += '\n';
+        }
+        out += "        </tr>\n";
+    }
+    out += "    </tbody>\n</table>\n</body>\n</html>\n";
+    return out;
+}
+
+std::string nanoizepp::bench::generate_nested(size_t size, uint64_t seed)
+{
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    append_head(out, random, "Nested");
+    out += "<body>\n";
+    while(out.size() < size) {
+        size_t depth = 50 + random.below(450);
+        for(size_t d = 0; d < depth; d++) {
+            append_indent(out, d % 16);
+            append(out, {"<div class=\"level-", std::to_string(d), "\">"});
+            if(random.chance(30))
+                out += pick_word(random);
+            out += '\n';
+        }
+        for(size_t d = depth; d-- > 0;) {
+            append_indent(out, d % 16);
+            out += "</div>\n";
+        }
+    }
+    out += "</body>\n</html>\n";
+    return out;
+}
+
+std::string nanoizepp::bench::generate_scripts(size_t size, uint64_t seed)
+{
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    append_head(out, random, "Application");
+    out += "<body>\n";
+    while(out.size() < size) {
+        if(random.chance(50)) {
+            out += "<script type=\"text/javascript\">\n";
+            for(size_t i = 0, n = 20 + random.below(200); i < n; i++) {
+                append(out, {"    function handler_", std::to_string(i), "(event) {\n"});
+                append(out, {"        if (event.value < ", std::to_string(random.below(100)), " && ready) {\n"});
+                out += "            console.log(\"<p>clicked</p>\", event);   // a comment\n";
+                out += "        }\n    }\n";
+            }
+            out += "</script>\n";
+        }
+        else {
+            out += "<style>\n";
+            for(size_t i = 0, n = 20 + random.below(200); i < n; i++) {
+                append(out, {"    .component-", std::to_string(i), " > .child:hover {\n"});
+                append(out, {"        color: #", std::to_string(100000 + random.below(800000)), ";\n"});
+                out += "        margin: 0px 4px   0px 4px;\n    }\n";
+            }
+            out += "</style>\n";
+        }
+        out += "<div id=\"app\"><p>";
+        append_sentences(out, random, 20, 1);
+        out += "</p></div>\n";
+    }
+    out += "</body>\n</html>\n";
+    return out;
+}
+
+std::string nanoizepp::bench::generate_comments(size_t size, uint64_t seed)
+{
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    append_head(out, random, "Template");
+    out += "<body>\n";
+    while(out.size() < size) {
+        switch(random.below(4)) {
+        case 0:
+            append(out, {"<!-- begin: partial/", std::to_string(random.below(100)), ".html -->\n"});
+            break;
+        case 1:
+            out += "<!--[if lt IE 9]><script src=\"html5shiv.js\"></script><![endif]-->\n";
+            break;
+        case 2:
+            out += "<!--\n    ";
+            append_sentences(out, random, 40, 1);
+            out += "\n-->\n";
+            break;
+        default:
+            out += "<!---->";
+            break;
+        }
+        out += "<section>\n    <p>";
+        append_sentences(out, random, 10 + random.below(20), 1);
+        out += "</p>\n</section>\n";
+    }
+    out += "</body>\n</html>\n";
+    return out;
+}
+
+std::string nanoizepp::bench::generate_malformed(size_t size, uint64_t seed)
+{
+    static constexpr std::string_view fragments[] = {
+        "<div", "<p>", "</p>", "</div>", "</ div>", "</span class=\"x\">", "<br/>", "<p/>", "<42>", "</42>",
+        "< ", "<", ">", "<!", "<! bogus comment>", "<!-- -- --!>", "<!--->", "<![CDATA[x]]>", "<?php echo 1; ?>",
+        "<a href=unquoted>", "<a href=\"unterminated>", "<img src=x src=y>", "<td>", "</tr>", "<h1>", "</h3>",
+        "<svg><![CDATA[<]]></svg>", "<b><i></b></i>", "\t\r\n", "   ", "&nbsp;", "&", "</>", "<//>",
+        "<input disabled>", "<DIV CLASS=\"Mixed\">", "</Div>", "<li>", "<li>", "</ul>", "<table><tr><td>",
+    };
+    Random random(seed);
+    std::string out;
+    out.reserve(size + 4096);
+    while(out.size() < size) {
+        if(random.chance(40)) {
+            out += pick_word(random);
+            out += ' ';
+        }
+        else {
+            out += fragments[random.below(std::size(fragments))];
+        }
+        if(random.chance(1))
+            out += '\0';
+    }
+    return out;
+}
+
+std::vector<Workload> nanoizepp::bench::generate_corpus(size_t size, uint64_t seed)
+{
+    std::vector<Workload> corpus;
+    corpus.push_back({"blog", generate_blog(size, seed)});
+    corpus.push_back({"table", generate_table(size, seed)});
+    corpus.push_back({"nested", generate_nested(size, seed)});
+    corpus.push_back({"scripts", generate_scripts(size, seed)});
+    corpus.push_back({"comments", generate_comments(size, seed)});
+    corpus.push_back({"malformed", generate_malformed(size, seed)});
+    return corpus;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace nanoizepp::bench
+{
+
+/**
+ * @brief Small deterministic PRNG (xorshift64*). Unlike the standard distributions it produces the same sequence on
+ * every platform and standard library, so the corpus is identical everywhere
+*/
+class Random
+{
+public:
+    explicit Random(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ull + 1) {}
+
+    uint64_t next()
+    {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    // Uniform in [0, n)
+    size_t below(size_t n) { return next() % n; }
+
+    bool chance(unsigned percent) { return below(100) < percent; }
+
+private:
+    uint64_t state;
+};
+
+struct Workload
+{
+    std::string name;
+    std::string html;
+};
+
+std::string generate_blog(size_t size, uint64_t seed);
+std::string generate_table(size_t size, uint64_t seed);
+std::string generate_nested(size_t size, uint64_t seed);
+std::string generate_scripts(size_t size, uint64_t seed);
+std::string generate_comments(size_t size, uint64_t seed);
+std::string generate_malformed(size_t size, uint64_t seed);
+
+/**
+ * @brief Generate every workload, each document about `size` bytes long
+*/
+std::vector<Workload> generate_corpus(size_t size, uint64_t seed = 42);
+
+}
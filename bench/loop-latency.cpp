@@ -0,0 +1,185 @@
+#include <nanoizepp/nanoizepp.hpp>
+#include <nanoizepp/coroutine.hpp>
+
+#include "corpus.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp::bench;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Measures how long a single threaded event loop is kept from its other work while it minimizes large pages. The loop
+ * runs a timer every `--interval` microseconds, standing in for the other connections it serves, and minimizes
+ * `--pages` generated pages one after another. With blocking, each page is one nanoize() call. With chunked, each
+ * loop iteration pulls one chunk from nanoize_chunks() and the page goes back to the end of the queue. Reported is
+ * how late the timer fired: the latency every other connection would see.
+*/
+
+struct LatencyOptions
+{
+    size_t document_size = 4 * 1024 * 1024;
+    size_t pages = 20;
+    size_t chunk_size = 16 * 1024;
+    std::chrono::microseconds interval{1000};
+    nanoizepp::Options nanoize;
+};
+
+static void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  --size BYTES       size of each page (default 4194304)\n"
+        "  --pages N          pages minimized in each mode (default 20)\n"
+        "  --chunk BYTES      chunk size of the chunked mode (default 16384)\n"
+        "  --interval US      period of the timer the latency is measured with (default 1000)\n",
+        argv0);
+}
+
+static bool parse_arguments(int argc, char** argv, LatencyOptions& options)
+{
+    for(int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto value = [&]() -> const char* {
+            if(i + 1 >= argc) {
+                std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if(arg == "--size")
+            options.document_size = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--pages")
+            options.pages = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--chunk")
+            options.chunk_size = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--interval")
+            options.interval = std::chrono::microseconds(std::strtoull(value(), nullptr, 10));
+        else if(arg == "--help") {
+            usage(argv[0]);
+            std::exit(0);
+        }
+        else
+            return false;
+    }
+    return options.document_size != 0 && options.pages != 0 && options.interval.count() > 0;
+}
+
+/**
+ * @brief A minimal event loop: a queue of tasks that each run one step, and a periodic timer that records how late
+ * it fires
+*/
+class EventLoop
+{
+public:
+    explicit EventLoop(std::chrono::microseconds interval) : interval(interval) {}
+
+    // Returns true when it wants to run again
+    void post(std::function<bool()> task) { tasks.push_back(std::move(task)); }
+
+    /**
+     * @return Lateness of each timer expiration, in microseconds
+    */
+    std::vector<double> run()
+    {
+        std::vector<double> lateness;
+        auto next_timer = Clock::now() + interval;
+        while(tasks.empty() == false) {
+            auto now = Clock::now();
+            if(now >= next_timer) {
+                lateness.push_back(std::chrono::duration<double, std::micro>(now - next_timer).count());
+                // A timer that missed several periods fires once, like timerfd or libuv timers
+                next_timer = std::max(next_timer + interval, now);
+            }
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            if(task())
+                tasks.push_back(std::move(task));
+        }
+        return lateness;
+    }
+
+private:
+    std::chrono::microseconds interval;
+    std::deque<std::function<bool()>> tasks;
+};
+
+struct Report
+{
+    double seconds = 0;
+    size_t output_bytes = 0;
+    std::vector<double> lateness;
+};
+
+static Report run_mode(bool chunked, const std::string& page, const LatencyOptions& options)
+{
+    Report report;
+    EventLoop loop(options.interval);
+    size_t remaining = options.pages;
+    std::optional<nanoizepp::ChunkGenerator> chunks;
+    loop.post([&]() {
+        if(chunked == false) {
+            // Stands in for writing the output to the socket
+            report.output_bytes += nanoizepp::nanoize(page, options.nanoize).size();
+            return --remaining != 0;
+        }
+        if(chunks.has_value() == false)
+            chunks.emplace(nanoizepp::nanoize_chunks(page, options.nanoize, options.chunk_size));
+        if(chunks->next()) {
+            report.output_bytes += chunks->chunk().size();
+            return true;
+        }
+        chunks.reset();
+        return --remaining != 0;
+    });
+    auto start = Clock::now();
+    report.lateness = loop.run();
+    report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return report;
+}
+
+static double percentile(std::vector<double>& values, double fraction)
+{
+    if(values.empty())
+        return 0;
+    auto nth = values.begin() + std::min(values.size() - 1, size_t(fraction * values.size()));
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+int main(int argc, char** argv)
+{
+    LatencyOptions options;
+    if(parse_arguments(argc, argv, options) == false) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::string page = generate_blog(options.document_size, 42);
+    std::printf("%-9s %10s %9s %12s %12s %12s\n", "mode", "MB/s", "timers", "p50 late us", "p99 late us",
+        "max late us");
+    size_t expected_bytes = 0;
+    for(bool chunked : {false, true}) {
+        Report report = run_mode(chunked, page, options);
+        if(chunked == false)
+            expected_bytes = report.output_bytes;
+        else if(report.output_bytes != expected_bytes)
+            std::abort();
+        double bytes = double(page.size()) * options.pages;
+        double max_late = report.lateness.empty() ? 0
+            : *std::max_element(report.lateness.begin(), report.lateness.end());
+        std::printf("%-9s %10.1f %9zu %12.0f %12.0f %12.0f\n", chunked ? "chunked" : "blocking",
+            bytes / report.seconds / 1e6, report.lateness.size(), percentile(report.lateness, 0.5),
+            percentile(report.lateness, 0.99), max_late);
+    }
+    return 0;
+}
@@ -0,0 +1,220 @@
+#include <nanoizepp/nanoizepp.hpp>
+#ifdef NANOIZEPP_HAS_ZLIB
+#include <nanoizepp/compress.hpp>
+#endif
+
+#include "alloc_counter.hpp"
+#include "corpus.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp::bench;
+
+struct BenchOptions
+{
+    size_t document_size = 1024 * 1024;
+    double min_time = 0.5;
+    std::string filter;
+    bool json = false;
+    // Minimize through one nanoizepp::Minimizer instead of separate nanoize() calls
+    bool reuse = false;
+    // Gzip the output: "fused" with nanoize_compressed(), "separate" minimizes then compresses the result
+    std::string compress;
+    nanoizepp::Options nanoize;
+};
+
+struct Result
+{
+    std::string name;
+    size_t input_bytes = 0;
+    size_t output_bytes = 0;
+    size_t iterations = 0;
+    double seconds = 0;
+    AllocStats allocs;
+};
+
+static void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  --size BYTES       size of each generated document (default 1048576)\n"
+        "  --min-time SECS    minimum time spent on each workload (default 0.5)\n"
+        "  --filter NAME      only run workloads whose name contains NAME\n"
+        "  --engine ENGINE    single-pass (default) or tree\n"
+        "  --indent N         indent the output by N spaces per level\n"
+        "  --newline          put every node on its own line\n"
+        "  --minify-css       minify the CSS of <style> elements and style attributes\n"
+        "  --minify-js        remove comments and whitespace from inline scripts and JSON blocks\n"
+        "  --minify-attributes\n"
+        "                     unquote values, drop default values and the values of boolean attributes\n"
+        "  --minify-entities\n"
+        "                     write character references in their shortest form, the output must be served as UTF-8\n"
+        "  --threads N        threads used per document (default 1, 0 for all hardware threads)\n"
+        "  --reuse            reuse one nanoizepp::Minimizer, allocations are counted after a warm-up run\n"
+#ifdef NANOIZEPP_HAS_ZLIB
+        "  --compress MODE    gzip the output, fused (while minimizing) or separate (after minimizing)\n"
+#endif
+        "  --json             print results as JSON, one workload per line\n",
+        argv0);
+}
+
+static bool parse_arguments(int argc, char** argv, BenchOptions& options)
+{
+    for(int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto value = [&]() -> const char* {
+            if(i + 1 >= argc) {
+                std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if(arg == "--size")
+            options.document_size = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--min-time")
+            options.min_time = std::strtod(value(), nullptr);
+        else if(arg == "--filter")
+            options.filter = value();
+        else if(arg == "--engine") {
+            std::string_view engine = value();
+            if(engine == "tree")
+                options.nanoize.engine = nanoizepp::Engine::Tree;
+            else if(engine == "single-pass")
+                options.nanoize.engine = nanoizepp::Engine::SinglePass;
+            else
+                return false;
+        }
+        else if(arg == "--indent")
+            options.nanoize.indent = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--newline")
+            options.nanoize.newline = true;
+        else if(arg == "--minify-css")
+            options.nanoize.minify_css = true;
+        else if(arg == "--minify-js")
+            options.nanoize.minify_js = true;
+        else if(arg == "--minify-attributes")
+            options.nanoize.minify_attributes = true;
+        else if(arg == "--minify-entities")
+            options.nanoize.minify_entities = true;
+        else if(arg == "--threads")
+            options.nanoize.threads = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--reuse")
+            options.reuse = true;
+#ifdef NANOIZEPP_HAS_ZLIB
+        else if(arg == "--compress") {
+            options.compress = value();
+            if(options.compress != "fused" && options.compress != "separate")
+                return false;
+        }
+#endif
+        else if(arg == "--json")
+            options.json = true;
+        else if(arg == "--help") {
+            usage(argv[0]);
+            std::exit(0);
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
+static Result run_workload(const Workload& workload, const BenchOptions& options)
+{
+    Result result;
+    result.name = workload.name;
+    result.input_bytes = workload.html.size();
+
+    nanoizepp::Minimizer minimizer(options.nanoize);
+    auto minimize = [&]() -> size_t {
+#ifdef NANOIZEPP_HAS_ZLIB
+        if(options.compress == "fused") {
+            std::string compressed;
+            nanoizepp::nanoize_compressed(workload.html, compressed, options.nanoize);
+            return compressed.size();
+        }
+        if(options.compress == "separate") {
+            std::string minimized = nanoizepp::nanoize(workload.html, options.nanoize);
+            std::string compressed;
+            nanoizepp::Compressor compressor;
+            auto append = [&](std::string_view block) { compressed += block; };
+            compressor.write(minimized, append);
+            compressor.finish(append);
+            return compressed.size();
+        }
+#endif
+        if(options.reuse)
+            return minimizer.nanoize(workload.html).size();
+        return nanoizepp::nanoize(workload.html, options.nanoize).size();
+    };
+
+    // Without --reuse, the first run warms up caches and the allocator and is the one allocations are counted on.
+    // With it, a warmed up minimizer is what is being measured (the tree engine's arena settles on the second run)
+    if(options.reuse) {
+        minimize();
+        minimize();
+    }
+    reset_peak();
+    auto before = alloc_stats();
+    result.output_bytes = minimize();
+    auto after = alloc_stats();
+    result.allocs.allocations = after.allocations - before.allocations;
+    result.allocs.allocated_bytes = after.allocated_bytes - before.allocated_bytes;
+    result.allocs.peak_bytes = after.peak_bytes;
+
+    using clock = std::chrono::steady_clock;
+    auto start = clock::now();
+    do {
+        // Keep the call from being optimized away
+        if(minimize() != result.output_bytes)
+            std::abort();
+        result.iterations++;
+        result.seconds = std::chrono::duration<double>(clock::now() - start).count();
+    } while(result.seconds < options.min_time || result.iterations < 3);
+    return result;
+}
+
+static void print_text(const Result& result)
+{
+    double bytes = double(result.input_bytes) * result.iterations;
+    std::printf("%-10s %9.1f MB/s %8.2f ns/B %8zu allocs/doc %10zu peak bytes %6.1f%% size\n",
+        result.name.c_str(), bytes / result.seconds / 1e6, result.seconds * 1e9 / bytes, result.allocs.allocations,
+        result.allocs.peak_bytes, 100.0 * result.output_bytes / result.input_bytes);
+}
+
+static void print_json(const Result& result)
+{
+    double bytes = double(result.input_bytes) * result.iterations;
+    std::printf("{\"workload\":\"%s\",\"input_bytes\":%zu,\"output_bytes\":%zu,\"iterations\":%zu,"
+        "\"mb_per_s\":%.3f,\"ns_per_byte\":%.4f,\"allocations\":%zu,\"allocated_bytes\":%zu,\"peak_bytes\":%zu}\n",
+        result.name.c_str(), result.input_bytes, result.output_bytes, result.iterations, bytes / result.seconds / 1e6,
+        result.seconds * 1e9 / bytes, result.allocs.allocations, result.allocs.allocated_bytes,
+        result.allocs.peak_bytes);
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    if(parse_arguments(argc, argv, options) == false) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    auto corpus = generate_corpus(options.document_size);
+    for(const auto& workload : corpus) {
+        if(workload.name.find(options.filter) == std::string::npos)
+            continue;
+        auto result = run_workload(workload, options);
+        if(options.json)
+            print_json(result);
+        else
+            print_text(result);
+        std::fflush(stdout);
+    }
+    return 0;
+}
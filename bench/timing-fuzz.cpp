@@ -0,0 +1,188 @@
+#include <nanoizepp/nanoizepp.hpp>
+
+#include "corpus.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp::bench;
+
+/**
+ * Looks for inputs that take far longer per byte than the others, the sign of superlinear parsing. Inputs repeat a
+ * short random motif of HTML fragments (repetition is what turns a rescan into quadratic work) with a few random
+ * mutations. Any input slower than `threshold` times the median time per byte is reported and saved, then timed
+ * again at four times the size: tag dense input is legitimately much slower per byte than input swallowed by an
+ * unterminated comment, only an input whose time per byte also grows with its size is superlinear.
+*/
+
+struct FuzzOptions
+{
+    size_t iterations = 500;
+    size_t document_size = 256 * 1024;
+    uint64_t seed = 1;
+    double threshold = 20;
+    std::string output_directory;
+    nanoizepp::Options nanoize;
+};
+
+// Pieces that start or end constructs the tokenizer scans for
+static constexpr std::string_view fragments[] = {
+    "<div>", "</div>", "<p>", "</span>", "</x-y>", "<x-y>", "<h1>", "</h4>", "<b><i>", "</i>", "<table><tr><td>",
+    "<svg>", "<math>", "<![CDATA[", "]]>", "<!--", "--", "--!", "-->", "<!", "<?", ">", "<", "< a", "</", "/>",
+    "<script>", "</scrip", "</script", "</script>", "<style>", "</STYLE", "<textarea>", " a=1", " a", " b=\"",
+    "\"", "='", " data-x=y", "=", "\t", "\n", "   ", std::string_view("\0", 1), "text", "&amp;", "&#", "x",
+};
+
+static void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+        "Usage: %s [options]\n"
+        "  --iterations N     number of inputs to try (default 500)\n"
+        "  --size BYTES       size of each input (default 262144)\n"
+        "  --seed N           seed of the generator (default 1)\n"
+        "  --threshold X      report inputs slower than X times the median time per byte (default 20)\n"
+        "  --out DIRECTORY    save the reported inputs there\n"
+        "  --engine ENGINE    single-pass (default) or tree\n",
+        argv0);
+}
+
+static bool parse_arguments(int argc, char** argv, FuzzOptions& options)
+{
+    for(int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto value = [&]() -> const char* {
+            if(i + 1 >= argc) {
+                std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if(arg == "--iterations")
+            options.iterations = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--size")
+            options.document_size = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--seed")
+            options.seed = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--threshold")
+            options.threshold = std::strtod(value(), nullptr);
+        else if(arg == "--out")
+            options.output_directory = value();
+        else if(arg == "--engine") {
+            std::string_view engine = value();
+            if(engine == "tree")
+                options.nanoize.engine = nanoizepp::Engine::Tree;
+            else if(engine == "single-pass")
+                options.nanoize.engine = nanoizepp::Engine::SinglePass;
+            else
+                return false;
+        }
+        else
+            return false;
+    }
+    return options.document_size != 0;
+}
+
+/**
+ * @brief A random prefix followed by a motif repeated up to `size` bytes, with a few random bytes changed
+*/
+static std::string generate_input(Random& random, size_t size)
+{
+    constexpr size_t fragment_count = sizeof(fragments) / sizeof(fragments[0]);
+    auto random_fragments = [&](size_t count) {
+        std::string text;
+        for(size_t i = 0; i < count; i++)
+            text += fragments[random.below(fragment_count)];
+        return text;
+    };
+
+    std::string html = random_fragments(random.below(4));
+    std::string motif = random_fragments(1 + random.below(4));
+    while(html.size() < size)
+        html += motif;
+    html.resize(size);
+    size_t mutations = random.below(8);
+    for(size_t i = 0; i < mutations; i++)
+        html[random.below(html.size())] = "<>/-!\"= \0"[random.below(9)];
+    return html;
+}
+
+// Growth of the time per byte, between an input and four copies of it, above which an input counts as superlinear
+static constexpr double max_growth = 2;
+
+// Best of three, documents the library rejects count as 0
+static double nanoseconds_per_byte(const std::string& html, const nanoizepp::Options& options)
+{
+    double best = 1e300;
+    for(int i = 0; i < 3; i++) {
+        auto start = std::chrono::steady_clock::now();
+        try {
+            nanoizepp::nanoize(html, options);
+        }
+        catch(const std::exception&) {
+            return 0;
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / double(html.size()));
+    }
+    return best;
+}
+
+int main(int argc, char** argv)
+{
+    FuzzOptions options;
+    if(parse_arguments(argc, argv, options) == false) {
+        usage(argv[0]);
+        return 1;
+    }
+    if(options.output_directory.empty() == false)
+        std::filesystem::create_directories(options.output_directory);
+
+    Random random(options.seed);
+    std::vector<double> timings;
+    size_t reported = 0;
+    size_t superlinear = 0;
+    double worst = 0;
+    for(size_t iteration = 0; iteration < options.iterations; iteration++) {
+        std::string html = generate_input(random, options.document_size);
+        double per_byte = nanoseconds_per_byte(html, options.nanoize);
+        if(per_byte == 0)
+            continue;
+        timings.push_back(per_byte);
+
+        // The median needs a few samples before it means anything
+        if(timings.size() < 20)
+            continue;
+        std::vector<double> sorted = timings;
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        double median = sorted[sorted.size() / 2];
+        worst = std::max(worst, per_byte / median);
+        if(per_byte <= median * options.threshold)
+            continue;
+
+        std::string larger;
+        while(larger.size() < html.size() * 4)
+            larger += html;
+        double scaled = nanoseconds_per_byte(larger, options.nanoize);
+        bool linear = scaled <= per_byte * max_growth;
+        std::printf("iteration %zu: %.2f ns/byte, %.1fx the median of %.2f ns/byte; %.2f ns/byte at 4x the size%s\n",
+            iteration, per_byte, per_byte / median, median, scaled, linear ? "" : ", SUPERLINEAR");
+        reported++;
+        if(linear == false)
+            superlinear++;
+        if(options.output_directory.empty() == false) {
+            auto path = std::filesystem::path(options.output_directory) / ("slow-" + std::to_string(iteration) + ".html");
+            std::ofstream(path, std::ios::binary).write(html.data(), std::streamsize(html.size()));
+        }
+    }
+
+    std::printf("%zu inputs timed, %zu reported, %zu superlinear, slowest %.1fx the median time per byte\n",
+        timings.size(), reported, superlinear, worst);
+    return superlinear == 0 ? 0 : 2;
+}
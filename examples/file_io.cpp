@@ -0,0 +1,226 @@
+#include "file_io.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define NANOIZE_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace nanoizepp::cli;
+
+// Smaller files are cheaper to read than to map
+static constexpr size_t min_mapped_size = 64 * 1024;
+
+static std::runtime_error io_error(const std::string& what, const std::string& name)
+{
+    return std::runtime_error(what + " " + name + ": " + std::strerror(errno));
+}
+
+InputFile::~InputFile()
+{
+    release();
+}
+
+InputFile::InputFile(InputFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+InputFile& InputFile::operator=(InputFile&& other) noexcept
+{
+    if(this == &other)
+        return *this;
+    release();
+    mapped = other.mapped;
+    size = other.size;
+    if(mapped)
+        data = other.data;
+    else {
+        buffer = std::move(other.buffer);
+        data = buffer.data();
+    }
+    other.data = nullptr;
+    other.size = 0;
+    other.mapped = false;
+    return *this;
+}
+
+void InputFile::release()
+{
+#ifdef NANOIZE_POSIX
+    if(mapped && size != 0)
+        munmap(const_cast<char*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    mapped = false;
+    buffer.clear();
+}
+
+#ifdef NANOIZE_POSIX
+
+InputFile InputFile::from_descriptor(int fd, const std::string& name)
+{
+    InputFile file;
+    struct stat info;
+    if(fstat(fd, &info) != 0)
+        throw io_error("Cannot stat", name);
+
+    if(S_ISREG(info.st_mode) && size_t(info.st_size) >= min_mapped_size) {
+        void* address = mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if(address != MAP_FAILED) {
+            // The whole file is read front to back exactly once
+            madvise(address, size_t(info.st_size), MADV_SEQUENTIAL);
+            file.data = static_cast<const char*>(address);
+            file.size = size_t(info.st_size);
+            file.mapped = true;
+            return file;
+        }
+    }
+
+    // Pipes, terminals and small files
+    if(S_ISREG(info.st_mode))
+        file.buffer.reserve(size_t(info.st_size));
+    char chunk[64 * 1024];
+    while(true) {
+        ssize_t count = read(fd, chunk, sizeof(chunk));
+        if(count == 0)
+            break;
+        if(count < 0) {
+            if(errno == EINTR)
+                continue;
+            throw io_error("Cannot read", name);
+        }
+        file.buffer.append(chunk, size_t(count));
+    }
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+    return file;
+}
+
+InputFile InputFile::open(const std::filesystem::path& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        throw io_error("Cannot open", path.string());
+    try {
+        InputFile file = from_descriptor(fd, path.string());
+        ::close(fd);
+        return file;
+    }
+    catch(...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+InputFile InputFile::standard_input()
+{
+    return from_descriptor(STDIN_FILENO, "<stdin>");
+}
+
+static void write_all(int fd, std::string_view data, const std::string& name)
+{
+    while(data.empty() == false) {
+        ssize_t count = ::write(fd, data.data(), data.size());
+        if(count < 0) {
+            if(errno == EINTR)
+                continue;
+            throw io_error("Cannot write", name);
+        }
+        data.remove_prefix(size_t(count));
+    }
+}
+
+void nanoizepp::cli::write_standard_output(std::string_view data)
+{
+    write_all(STDOUT_FILENO, data, "<stdout>");
+}
+
+void nanoizepp::cli::write_file_atomically(const std::filesystem::path& path, std::string_view data)
+{
+    std::string temporary = path.string() + ".nanoize-tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if(fd < 0)
+        throw io_error("Cannot create", temporary);
+    try {
+        // Keep the permissions of a file that is replaced
+        struct stat info;
+        if(stat(path.c_str(), &info) == 0)
+            fchmod(fd, info.st_mode & 07777);
+        write_all(fd, data, temporary);
+    }
+    catch(...) {
+        ::close(fd);
+        ::unlink(temporary.c_str());
+        throw;
+    }
+    if(::close(fd) != 0 || ::rename(temporary.c_str(), path.c_str()) != 0) {
+        auto error = io_error("Cannot write", path.string());
+        ::unlink(temporary.c_str());
+        throw error;
+    }
+}
+
+#else
+
+InputFile InputFile::open(const std::filesystem::path& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if(in.is_open() == false)
+        throw io_error("Cannot open", path.string());
+    InputFile file;
+    file.buffer.assign(std::istreambuf_iterator<char>(in), {});
+    if(in.bad())
+        throw io_error("Cannot read", path.string());
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+    return file;
+}
+
+InputFile InputFile::standard_input()
+{
+    std::ios::sync_with_stdio(false);
+    InputFile file;
+    file.buffer.assign(std::istreambuf_iterator<char>(std::cin), {});
+    file.data = file.buffer.data();
+    file.size = file.buffer.size();
+    return file;
+}
+
+void nanoizepp::cli::write_standard_output(std::string_view data)
+{
+    if(std::fwrite(data.data(), 1, data.size(), stdout) != data.size() || std::fflush(stdout) != 0)
+        throw io_error("Cannot write", "<stdout>");
+}
+
+void nanoizepp::cli::write_file_atomically(const std::filesystem::path& path, std::string_view data)
+{
+    auto temporary = path;
+    temporary += ".nanoize-tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), std::streamsize(data.size()));
+        if(out.good() == false)
+            throw io_error("Cannot write", temporary.string());
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if(error) {
+        std::filesystem::remove(temporary, error);
+        throw std::runtime_error("Cannot write " + path.string());
+    }
+}
+
+#endif
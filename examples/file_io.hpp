@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace nanoizepp::cli
+{
+
+/**
+ * @brief Read-only view of a whole file. Large files are memory-mapped where the platform supports it, small ones
+ * (and files that cannot be mapped, like pipes) are read into a buffer
+*/
+class InputFile
+{
+public:
+    InputFile() = default;
+    ~InputFile();
+    InputFile(InputFile&& other) noexcept;
+    InputFile& operator=(InputFile&& other) noexcept;
+
+    /**
+     * @brief Open and map or read `path`. Throws std::runtime_error on failure
+    */
+    static InputFile open(const std::filesystem::path& path);
+
+    /**
+     * @brief Read all of standard input, mapping it if it is redirected from a regular file
+    */
+    static InputFile standard_input();
+
+    std::string_view contents() const { return {data, size}; }
+
+private:
+    static InputFile from_descriptor(int fd, const std::string& name);
+    void release();
+
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    // Used when the file is read instead of mapped
+    std::string buffer;
+};
+
+/**
+ * @brief Write all of `data` to standard output, in as few calls as the OS allows
+*/
+void write_standard_output(std::string_view data);
+
+/**
+ * @brief Replace `path` with `data`. The file is written next to its destination under a temporary name and renamed
+ * over it, so readers never see a half-written file
+*/
+void write_file_atomically(const std::filesystem::path& path, std::string_view data);
+
+}
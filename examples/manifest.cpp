@@ -0,0 +1,93 @@
+#include "manifest.hpp"
+#include "file_io.hpp"
+
+#include <nanoizepp/hash.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace nanoizepp;
+using namespace nanoizepp::cli;
+
+Manifest::Manifest(std::filesystem::path file, const Options& options, std::span<const Placeholder> placeholders)
+    : file(std::move(file))
+{
+    header = "nanoize-manifest 1 indent=" + std::to_string(options.indent) + " newline=" + (options.newline ? "1" : "0")
+        + " css=" + (options.minify_css ? "1" : "0")
+        + " js=" + (options.minify_js ? "1" : "0")
+        + " attributes=" + (options.minify_attributes ? "1" : "0")
+        + " entities=" + (options.minify_entities ? "1" : "0");
+    // Manifests of plain HTML keep the header they had before templates were supported
+    if(placeholders.empty() == false) {
+        header += " placeholders=";
+        for(const auto& placeholder : placeholders) {
+            header.append(placeholder.open);
+            header += ' ';
+            header.append(placeholder.close);
+            header += ',';
+        }
+    }
+}
+
+void Manifest::load()
+{
+    std::ifstream in(file, std::ios::binary);
+    std::string line;
+    if(std::getline(in, line).fail() || line != header)
+        return;
+    while(std::getline(in, line)) {
+        std::istringstream fields(line);
+        Entry entry;
+        fields >> entry.size >> entry.modified >> entry.hash;
+        // The path is the rest of the line, spaces included
+        std::string key;
+        if(fields.get() != ' ' || std::getline(fields, key).fail() || key.empty())
+            continue;
+        entries[key] = std::move(entry);
+    }
+}
+
+void Manifest::save() const
+{
+    std::lock_guard lock(mutex);
+    if(changed == false)
+        return;
+    std::string text = header + "\n";
+    for(const auto& [key, entry] : entries) {
+        // Paths with newlines cannot be stored, those files are simply processed every time
+        if(key.find('\n') != std::string::npos)
+            continue;
+        text += std::to_string(entry.size) + " " + std::to_string(entry.modified) + " " + entry.hash + " " + key + "\n";
+    }
+    write_file_atomically(file, text);
+}
+
+std::optional<Manifest::Entry> Manifest::find(const std::string& key) const
+{
+    std::lock_guard lock(mutex);
+    auto it = entries.find(key);
+    if(it == entries.end())
+        return std::nullopt;
+    return it->second;
+}
+
+void Manifest::update(const std::string& key, Entry entry)
+{
+    std::lock_guard lock(mutex);
+    entries[key] = std::move(entry);
+    changed = true;
+}
+
+std::string nanoizepp::cli::content_hash(const std::string_view data)
+{
+    auto hash = detail::hash128(data);
+    char hex[33];
+    std::snprintf(hex, sizeof(hex), "%016llx%016llx", (unsigned long long)hash.high, (unsigned long long)hash.low);
+    return hex;
+}
+
+int64_t nanoizepp::cli::modification_time(const std::filesystem::path& path)
+{
+    return int64_t(std::filesystem::last_write_time(path).time_since_epoch().count());
+}
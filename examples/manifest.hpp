@@ -0,0 +1,68 @@
+#pragma once
+
+#include <nanoizepp/nanoizepp.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace nanoizepp::cli
+{
+
+/**
+ * @brief Record of the files a previous run has processed, used to skip unchanged files
+ *
+ * Stored as a text file, one line per file: size, modification time and content hash of the source as it was left
+ * by the run, followed by the path relative to the manifest. A file whose size and time still match is skipped
+ * without being read, one whose time changed but whose content hashes the same is skipped after reading it. The
+ * first line records the output options, a manifest written with other options is ignored.
+*/
+class Manifest
+{
+public:
+    struct Entry
+    {
+        uintmax_t size = 0;
+        int64_t modified = 0;
+        std::string hash;
+    };
+
+    /**
+     * @param placeholders Delimiters of template placeholders, when minimizing templates
+    */
+    Manifest(std::filesystem::path file, const Options& options, std::span<const Placeholder> placeholders = {});
+
+    /**
+     * @brief Load the manifest file if there is one written with the same options
+    */
+    void load();
+
+    /**
+     * @brief Write the manifest file back if anything changed
+    */
+    void save() const;
+
+    std::optional<Entry> find(const std::string& key) const;
+    void update(const std::string& key, Entry entry);
+
+private:
+    std::filesystem::path file;
+    std::string header;
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    bool changed = false;
+};
+
+/**
+ * @brief Content hash used by the manifest, as hex
+*/
+std::string content_hash(std::string_view data);
+
+int64_t modification_time(const std::filesystem::path& path);
+
+}
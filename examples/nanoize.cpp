@@ -1,22 +1,448 @@
 #include <nanoizepp/nanoizepp.hpp>
-#include <iostream>
-
-int main()
-{
-    std::string html = 
-R"(
-<!DOCTYPE html>
-<html>
-    <head>
-        <title>Test</title>
-    </head>
-    <body>
-        <h1>Test</h1>
-        <p>Test</p>
-    </body>
-</html>
-)";
-    std::string miniaturized = nanoizepp::nanoize(html);
-    std::cout << miniaturized << std::endl;
+#ifdef NANOIZEPP_HAS_ZLIB
+#include <nanoizepp/compress.hpp>
+#endif
+
+#include "file_io.hpp"
+#include "manifest.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace nanoizepp::cli;
+
+static constexpr std::string_view manifest_name = ".nanoize-manifest";
+
+struct CliOptions
+{
+    std::vector<fs::path> inputs;
+    std::optional<fs::path> output;
+    bool in_place = false;
+    bool force = false;
+    bool quiet = false;
+    // Also write a gzip compressed copy of every output file
+    bool gzip = false;
+    size_t threads = 0;
+    std::vector<std::string> extensions{".html", ".htm"};
+    nanoizepp::Options nanoize;
+    // Minimize templates, keeping their placeholders
+    bool templates = false;
+    // Delimiters given with --placeholder, the default ones if there are none
+    std::vector<nanoizepp::Placeholder> placeholders;
+
+    std::span<const nanoizepp::Placeholder> template_placeholders() const
+    {
+        if(templates == false)
+            return {};
+        if(placeholders.empty())
+            return nanoizepp::default_placeholders;
+        return placeholders;
+    }
+};
+
+/**
+ * @brief One file to minimize
+*/
+struct Job
+{
+    fs::path source;
+    fs::path destination;
+    // Where the file is recorded, if anywhere
+    Manifest* manifest = nullptr;
+    std::string key;
+    uintmax_t size = 0;
+};
+
+struct Summary
+{
+    std::atomic<size_t> minimized{0};
+    std::atomic<size_t> unchanged{0};
+    std::atomic<size_t> failed{0};
+    std::atomic<size_t> input_bytes{0};
+    std::atomic<size_t> output_bytes{0};
+};
+
+static void usage(const char* argv0)
+{
+    std::fprintf(stderr,
+        "Usage: %s [options] [PATH...]\n"
+        "Minimize HTML. Without PATH (or with -) reads standard input and writes standard output, a single file is\n"
+        "written to standard output unless -o or -i is given. Directories are processed recursively.\n"
+        "  -o, --output PATH  output file for a single input, otherwise a directory that mirrors the inputs\n"
+        "  -i, --in-place     overwrite the input files\n"
+        "  -j, --threads N    files minimized in parallel (default 0, one per hardware thread)\n"
+        "      --ext LIST     comma separated extensions processed in directories (default .html,.htm)\n"
+        "      --force        minimize files even if they did not change since the last run\n"
+        "      --indent N     indent the output by N spaces per level\n"
+        "      --newline      put every node on its own line\n"
+        "      --minify-css   minify the CSS of <style> elements and style attributes\n"
+        "      --minify-js    remove comments and whitespace from inline scripts and JSON blocks\n"
+        "      --minify-attributes\n"
+        "                     unquote values, drop default values and the values of boolean attributes\n"
+        "      --minify-entities\n"
+        "                     write character references in their shortest form, the output must be served as UTF-8\n"
+        "      --template     the inputs are templates: keep {{ }}, {%% %%}, {# #}, <%% %%> and [[ ]] placeholders as\n"
+        "                     they are\n"
+        "      --placeholder OPEN CLOSE\n"
+        "                     keep placeholders with these delimiters instead, can be repeated (implies --template)\n"
+#ifdef NANOIZEPP_HAS_ZLIB
+        "      --gzip         also write a compressed FILE.gz next to every output file, for servers that serve\n"
+        "                     precompressed files\n"
+#endif
+        "  -q, --quiet        do not print a summary\n"
+        "      --help         show this help\n",
+        argv0);
+}
+
+static std::vector<std::string> split_extensions(std::string_view list)
+{
+    std::vector<std::string> extensions;
+    while(list.empty() == false) {
+        auto comma = list.find(',');
+        auto extension = list.substr(0, comma);
+        if(extension.empty() == false) {
+            std::string& added = extensions.emplace_back();
+            if(extension[0] != '.')
+                added.push_back('.');
+            added.append(extension);
+        }
+        list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+    }
+    return extensions;
+}
+
+static bool parse_arguments(int argc, char** argv, CliOptions& options)
+{
+    for(int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto value = [&]() -> const char* {
+            if(i + 1 >= argc) {
+                std::fprintf(stderr, "Missing value for %s\n", argv[i]);
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if(arg == "-o" || arg == "--output")
+            options.output = value();
+        else if(arg == "-i" || arg == "--in-place")
+            options.in_place = true;
+        else if(arg == "-j" || arg == "--threads")
+            options.threads = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--ext")
+            options.extensions = split_extensions(value());
+        else if(arg == "--force")
+            options.force = true;
+        else if(arg == "--indent")
+            options.nanoize.indent = std::strtoull(value(), nullptr, 10);
+        else if(arg == "--newline")
+            options.nanoize.newline = true;
+        else if(arg == "--minify-css")
+            options.nanoize.minify_css = true;
+        else if(arg == "--minify-js")
+            options.nanoize.minify_js = true;
+        else if(arg == "--minify-attributes")
+            options.nanoize.minify_attributes = true;
+        else if(arg == "--minify-entities")
+            options.nanoize.minify_entities = true;
+        else if(arg == "--template")
+            options.templates = true;
+        else if(arg == "--placeholder") {
+            std::string_view open = value();
+            options.placeholders.push_back({open, value()});
+            options.templates = true;
+        }
+#ifdef NANOIZEPP_HAS_ZLIB
+        else if(arg == "--gzip")
+            options.gzip = true;
+#endif
+        else if(arg == "-q" || arg == "--quiet")
+            options.quiet = true;
+        else if(arg == "--help") {
+            usage(argv[0]);
+            std::exit(0);
+        }
+        else if(arg.size() > 1 && arg[0] == '-')
+            return false;
+        else
+            options.inputs.emplace_back(arg);
+    }
+    if(options.in_place && options.output) {
+        std::fprintf(stderr, "--in-place and --output cannot be combined\n");
+        return false;
+    }
+    if(options.gzip && options.in_place == false && options.output.has_value() == false) {
+        std::fprintf(stderr, "--gzip needs --output or --in-place\n");
+        return false;
+    }
+    return true;
+}
+
+static fs::path gzip_path(const fs::path& path)
+{
+    return fs::path(path) += ".gz";
+}
+
+/**
+ * @brief Write `output` to `path`, and its compressed copy if asked to
+*/
+static void write_output(const fs::path& path, std::string_view output, bool gzip)
+{
+    write_file_atomically(path, output);
+#ifdef NANOIZEPP_HAS_ZLIB
+    if(gzip) {
+        // Assets are compressed once and served many times, the smallest output is worth the time
+        nanoizepp::Compressor compressor({.level = 9});
+        std::string compressed;
+        auto append = [&](std::string_view block) { compressed += block; };
+        compressor.write(output, append);
+        compressor.finish(append);
+        write_file_atomically(gzip_path(path), compressed);
+    }
+#else
+    (void)gzip;
+#endif
+}
+
+/**
+ * @brief Minimize standard input or a single file to standard output or a single file
+*/
+static int run_single(const CliOptions& options)
+{
+    const bool from_stdin = options.inputs.empty() || options.inputs[0] == "-";
+    InputFile input = from_stdin ? InputFile::standard_input() : InputFile::open(options.inputs[0]);
+    std::string output;
+    if(options.templates)
+        output = nanoizepp::nanoize_template(input.contents(), options.nanoize, options.template_placeholders());
+    else
+        nanoizepp::nanoize(input.contents(), output, options.nanoize);
+    if(options.output)
+        write_output(*options.output, output, options.gzip);
+    else if(options.in_place)
+        write_output(options.inputs[0], output, options.gzip);
+    else
+        write_standard_output(output);
     return 0;
-}
\ No newline at end of file
+}
+
+static bool has_extension(const fs::path& path, const std::vector<std::string>& extensions)
+{
+    auto extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+        return char(std::tolower(c));
+    });
+    return std::find(extensions.begin(), extensions.end(), extension) != extensions.end();
+}
+
+/**
+ * @brief List the files to minimize, with one manifest per output directory tree
+*/
+static std::vector<Job> collect_jobs(const CliOptions& options, std::map<fs::path, std::unique_ptr<Manifest>>& manifests)
+{
+    auto manifest_for = [&](const fs::path& directory) {
+        auto& manifest = manifests[directory];
+        if(manifest == nullptr) {
+            manifest = std::make_unique<Manifest>(directory / manifest_name, options.nanoize,
+                options.template_placeholders());
+            if(options.force == false)
+                manifest->load();
+        }
+        return manifest.get();
+    };
+
+    std::optional<fs::path> output_root;
+    if(options.output)
+        output_root = fs::weakly_canonical(*options.output);
+
+    std::vector<Job> jobs;
+    for(const auto& input : options.inputs) {
+        if(fs::is_directory(input) == false) {
+            Job job;
+            job.source = input;
+            job.size = fs::file_size(input);
+            if(options.output) {
+                auto manifest = manifest_for(*output_root);
+                job.destination = *output_root / input.filename();
+                job.manifest = manifest;
+                job.key = input.filename().generic_string();
+            }
+            else
+                job.destination = input;
+            jobs.push_back(std::move(job));
+            continue;
+        }
+
+        fs::path root = fs::weakly_canonical(input);
+        fs::path destination_root = output_root ? *output_root : root;
+        Manifest* manifest = manifest_for(destination_root);
+        for(auto it = fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied);
+            it != fs::recursive_directory_iterator(); ++it) {
+            // Do not descend into the mirror if it is inside the input tree
+            if(it->is_directory() && output_root && it->path() == *output_root) {
+                it.disable_recursion_pending();
+                continue;
+            }
+            if(it->is_regular_file() == false || has_extension(it->path(), options.extensions) == false)
+                continue;
+            Job job;
+            job.source = it->path();
+            auto relative = fs::relative(it->path(), root);
+            job.destination = destination_root / relative;
+            job.manifest = manifest;
+            job.key = relative.generic_string();
+            job.size = it->file_size();
+            jobs.push_back(std::move(job));
+        }
+    }
+    return jobs;
+}
+
+static void process_job(const Job& job, nanoizepp::Minimizer& minimizer, const CliOptions& options, Summary& summary)
+{
+    // A missing compressed copy is made even if the file did not change
+    const bool destination_exists = (job.source == job.destination || fs::exists(job.destination))
+        && (options.gzip == false || fs::exists(gzip_path(job.destination)));
+    std::optional<Manifest::Entry> recorded;
+    if(job.manifest && options.force == false && destination_exists)
+        recorded = job.manifest->find(job.key);
+
+    int64_t modified = modification_time(job.source);
+    if(recorded && recorded->size == job.size && recorded->modified == modified) {
+        summary.unchanged++;
+        return;
+    }
+
+    InputFile input = InputFile::open(job.source);
+    std::string hash;
+    if(job.manifest) {
+        hash = content_hash(input.contents());
+        if(recorded && recorded->hash == hash) {
+            // Touched but not modified
+            job.manifest->update(job.key, {job.size, modified, hash});
+            summary.unchanged++;
+            return;
+        }
+    }
+
+    std::string template_output;
+    std::string_view output;
+    if(options.templates) {
+        template_output = nanoizepp::nanoize_template(input.contents(), options.nanoize,
+            options.template_placeholders());
+        output = template_output;
+    }
+    else
+        output = minimizer.nanoize(input.contents());
+    if(job.destination.has_parent_path()) {
+        // Other threads may be creating the same directories, a failure shows up when writing the file
+        std::error_code error;
+        fs::create_directories(job.destination.parent_path(), error);
+    }
+    write_output(job.destination, output, options.gzip);
+    summary.minimized++;
+    summary.input_bytes += input.contents().size();
+    summary.output_bytes += output.size();
+
+    if(job.manifest) {
+        // In place, the next run sees the minimized file
+        if(job.source == job.destination)
+            job.manifest->update(job.key, {output.size(), modification_time(job.destination), content_hash(output)});
+        else
+            job.manifest->update(job.key, {job.size, modified, std::move(hash)});
+    }
+}
+
+/**
+ * @brief Minimize files on several threads, largest first, each thread reusing one Minimizer
+*/
+static void process_jobs(std::vector<Job>& jobs, const CliOptions& options, Summary& summary)
+{
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.size > b.size; });
+
+    size_t thread_count = options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    thread_count = std::min(thread_count, std::max<size_t>(jobs.size(), 1));
+    std::atomic<size_t> next{0};
+    std::mutex error_mutex;
+    auto work = [&]() {
+        nanoizepp::Minimizer minimizer(options.nanoize);
+        for(size_t i = next++; i < jobs.size(); i = next++) {
+            try {
+                process_job(jobs[i], minimizer, options, summary);
+            }
+            catch(const std::exception& error) {
+                summary.failed++;
+                std::lock_guard lock(error_mutex);
+                std::fprintf(stderr, "nanoize: %s: %s\n", jobs[i].source.string().c_str(), error.what());
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(size_t i = 1; i < thread_count; i++)
+        threads.emplace_back(work);
+    work();
+    for(auto& thread : threads)
+        thread.join();
+}
+
+static void print_summary(const Summary& summary, double seconds)
+{
+    double input = double(summary.input_bytes), output = double(summary.output_bytes);
+    std::fprintf(stderr, "%zu minimized, %zu unchanged, %zu failed: %.0f -> %.0f bytes (%.1f%% saved) in %.3f s (%.1f MB/s)\n",
+        summary.minimized.load(), summary.unchanged.load(), summary.failed.load(), input, output,
+        input == 0 ? 0.0 : 100.0 * (input - output) / input, seconds, seconds == 0 ? 0.0 : input / seconds / 1e6);
+}
+
+int main(int argc, char** argv)
+{
+    CliOptions options;
+    if(parse_arguments(argc, argv, options) == false) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    try {
+        // One stream in, one stream out
+        bool single_input = options.inputs.size() <= 1
+            && (options.inputs.empty() || options.inputs[0] == "-" || fs::is_directory(options.inputs[0]) == false);
+        bool single_output = options.output.has_value() == false || fs::is_directory(*options.output) == false;
+        if(single_input && single_output)
+            return run_single(options);
+
+        if(options.output.has_value() == false && options.in_place == false) {
+            std::fprintf(stderr, "nanoize: several inputs need --output DIRECTORY or --in-place\n");
+            return 2;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::map<fs::path, std::unique_ptr<Manifest>> manifests;
+        auto jobs = collect_jobs(options, manifests);
+        Summary summary;
+        process_jobs(jobs, options, summary);
+        for(const auto& [directory, manifest] : manifests)
+            manifest->save();
+
+        if(options.quiet == false)
+            print_summary(summary, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        return summary.failed == 0 ? 0 : 1;
+    }
+    catch(const std::exception& error) {
+        std::fprintf(stderr, "nanoize: %s\n", error.what());
+        return 1;
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * @brief Bump allocator. Memory is handed out from large blocks and only released all at once when the arena is
+ * destroyed or reset(). Only trivially destructible objects may be allocated, their destructors never run.
+*/
+class Arena
+{
+public:
+    explicit Arena(size_t first_block_size = 16 * 1024,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : blocks(resource), next_block_size(first_block_size)
+    {
+    }
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena()
+    {
+        release();
+    }
+
+    void* allocate(size_t size, size_t alignment)
+    {
+        size_t offset = (used + alignment - 1) & ~(alignment - 1);
+        if(blocks.empty() || offset + size > current_size) {
+            add_block(size + alignment);
+            offset = 0;
+        }
+        used = offset + size;
+        return blocks.back().data + offset;
+    }
+
+    template <typename T, typename... Args>
+    T* make(Args&&... args)
+    {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena never runs destructors");
+        return new (allocate(sizeof(T), alignof(T))) T{std::forward<Args>(args)...};
+    }
+
+    /**
+     * @brief Copy an array of trivially copyable objects into the arena
+    */
+    template <typename T>
+    std::span<const T> copy(const std::span<const T> items)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>);
+        if(items.empty())
+            return {};
+        T* data = static_cast<T*>(allocate(sizeof(T) * items.size(), alignof(T)));
+        std::uninitialized_copy(items.begin(), items.end(), data);
+        return {data, items.size()};
+    }
+
+    /**
+     * @brief Copy a string into the arena
+    */
+    std::string_view copy(const std::string_view sv)
+    {
+        if(sv.empty())
+            return {};
+        char* data = static_cast<char*>(allocate(sv.size(), 1));
+        std::memcpy(data, sv.data(), sv.size());
+        return {data, sv.size()};
+    }
+
+    /**
+     * @brief Free everything allocated so far. If that took several blocks they are replaced by a single one as large
+     * as all of them together, so an arena reused for similar workloads stops allocating
+    */
+    void reset()
+    {
+        if(blocks.size() > 1) {
+            size_t total = 0;
+            for(const auto& block : blocks)
+                total += block.size;
+            release();
+            add_block(total);
+        }
+        used = 0;
+    }
+
+private:
+    struct Block
+    {
+        std::byte* data;
+        size_t size;
+    };
+
+    void add_block(size_t min_size)
+    {
+        size_t size = std::max(next_block_size, min_size);
+        auto resource = blocks.get_allocator().resource();
+        blocks.push_back({static_cast<std::byte*>(resource->allocate(size, alignof(std::max_align_t))), size});
+        current_size = size;
+        next_block_size = size * 2;
+    }
+
+    void release()
+    {
+        auto resource = blocks.get_allocator().resource();
+        for(const auto& block : blocks)
+            resource->deallocate(block.data, block.size, alignof(std::max_align_t));
+        blocks.clear();
+    }
+
+    std::pmr::vector<Block> blocks;
+    size_t current_size = 0;
+    size_t used = 0;
+    size_t next_block_size;
+};
+
+}
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+#include "css.hpp"
+#include "parser.hpp"
+#include "references.hpp"
+#include "tags.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * @brief How an attribute can be shortened on some elements
+*/
+struct AttributeRule
+{
+    std::string_view name;
+    // Elements the rule applies to, all of them if the first is 0. Every name used here must be a known tag
+    std::array<TagId, 8> tags{};
+    // The attribute is removed when it has this value (compared case-insensitively). Empty for boolean attributes,
+    // which are written without their value
+    std::string_view default_value = {};
+};
+
+/**
+ * Boolean attributes, and the default values that can be removed without changing what the element does. Only
+ * defaults that stylesheets practically never select on are listed: `input[type=text]` is common, so the type of an
+ * input stays.
+*/
+inline constexpr AttributeRule attribute_rules[] = {
+    {"allowfullscreen", {find_known_tag("iframe")}},
+    {"async", {script_tag}},
+    {"autofocus"},
+    {"autoplay", {audio_tag, video_tag}},
+    {"checked", {find_known_tag("input")}},
+    {"controls", {audio_tag, video_tag}},
+    {"default", {find_known_tag("track")}},
+    {"defer", {script_tag}},
+    {"disabled", {find_known_tag("button"), find_known_tag("fieldset"), find_known_tag("input"),
+        find_known_tag("link"), find_known_tag("optgroup"), find_known_tag("option"), find_known_tag("select"),
+        find_known_tag("textarea")}},
+    {"formnovalidate", {find_known_tag("button"), find_known_tag("input")}},
+    {"inert"},
+    {"ismap", {find_known_tag("img")}},
+    {"itemscope"},
+    {"loop", {audio_tag, video_tag}},
+    {"multiple", {find_known_tag("input"), find_known_tag("select")}},
+    {"muted", {audio_tag, video_tag}},
+    {"nomodule", {script_tag}},
+    {"novalidate", {find_known_tag("form")}},
+    {"open", {find_known_tag("details"), find_known_tag("dialog")}},
+    {"playsinline", {video_tag}},
+    {"readonly", {find_known_tag("input"), find_known_tag("textarea")}},
+    {"required", {find_known_tag("input"), find_known_tag("select"), find_known_tag("textarea")}},
+    {"reversed", {find_known_tag("ol")}},
+    {"selected", {find_known_tag("option")}},
+    {"type", {script_tag}, "text/javascript"},
+    {"type", {style_tag, find_known_tag("link")}, "text/css"},
+    {"method", {find_known_tag("form")}, "get"},
+    {"enctype", {find_known_tag("form")}, "application/x-www-form-urlencoded"},
+    {"colspan", {find_known_tag("td"), find_known_tag("th")}, "1"},
+    {"rowspan", {find_known_tag("td"), find_known_tag("th")}, "1"},
+    {"shape", {find_known_tag("area")}, "rect"},
+};
+
+/**
+ * @brief Stands for a template placeholder in the input while nanoize_template() minimizes, see
+ * Options::placeholder_markers
+*/
+inline constexpr char placeholder_marker = '\x1A';
+
+/**
+ * @brief true if `text` contains a placeholder that has to be written as it is
+*/
+constexpr bool has_placeholder(const std::string_view text, const Options& options)
+{
+    return options.placeholder_markers && text.find(placeholder_marker) != std::string_view::npos;
+}
+
+/**
+ * @brief The rule for attribute `name` of `tag`, if there is one
+*/
+constexpr std::optional<AttributeRule> find_attribute_rule(const Tag tag, const std::string_view name)
+{
+    // Rules only apply to known elements, custom ones may give these attributes any meaning. The rule is returned by
+    // value: GCC does not accept testing pointers into the table during constant evaluation
+    if(tag.id == 0)
+        return std::nullopt;
+    for(const auto& rule : attribute_rules) {
+        if(rule.name.size() != name.size() || equals_ignore_case(rule.name, name) == false)
+            continue;
+        if(rule.tags[0] == 0 || std::find(rule.tags.begin(), rule.tags.end(), tag.id) != rule.tags.end())
+            return rule;
+    }
+    return std::nullopt;
+}
+
+constexpr bool is_attribute_whitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+/**
+ * @brief true if `value` can be written without quotes
+*/
+constexpr bool can_be_unquoted(const std::string_view value)
+{
+    for(char c : value) {
+        if(is_attribute_whitespace(c) || c == '"' || c == '\'' || c == '=' || c == '<' || c == '>' || c == '`')
+            return false;
+    }
+    return value.empty() == false;
+}
+
+/**
+ * @brief Write the class names in `value` separated by single spaces
+*/
+template <typename Sink>
+constexpr void append_class_names(Sink& out, std::string_view value)
+{
+    bool first = true;
+    size_t start = 0;
+    while(start < value.size()) {
+        if(is_attribute_whitespace(value[start])) {
+            start++;
+            continue;
+        }
+        size_t end = start + 1;
+        while(end < value.size() && is_attribute_whitespace(value[end]) == false)
+            end++;
+        if(first == false)
+            out.append(1, ' ');
+        out.append(value.substr(start, end - start));
+        first = false;
+        start = end;
+    }
+}
+
+/**
+ * @brief Write `value` between `quote`s, replacing the quote characters it contains with character references
+*/
+template <typename Sink>
+constexpr void append_escaped_value(Sink& out, std::string_view value, char quote)
+{
+    const std::string_view reference = quote == '"' ? "&quot;" : "&#39;";
+    size_t start = 0;
+    for(size_t found = value.find(quote); found != std::string_view::npos; found = value.find(quote, start)) {
+        out.append(value.substr(start, found - start));
+        out.append(reference);
+        start = found + 1;
+    }
+    out.append(value.substr(start));
+}
+
+/**
+ * @brief Counts what append_shortened_references() writes, to choose how to quote an attribute value
+*/
+class QuoteCounter
+{
+public:
+    size_t double_quotes = 0;
+    size_t single_quotes = 0;
+    bool needs_quotes = false;
+
+    constexpr void append(const std::string_view sv)
+    {
+        double_quotes += std::count(sv.begin(), sv.end(), '"');
+        single_quotes += std::count(sv.begin(), sv.end(), '\'');
+        needs_quotes |= sv.empty() == false && can_be_unquoted(sv) == false;
+    }
+
+    constexpr void append(size_t count, char c)
+    {
+        for(size_t i = 0; i < count; i++)
+            append(std::string_view(&c, 1));
+    }
+};
+
+/**
+ * @brief Write `value` with its character references shortened, quoted with the quote character it contains the
+ * least of after decoding, or without quotes if `allow_unquoted` and the decoded value can be
+*/
+template <typename Sink>
+constexpr void append_shortened_value(Sink& out, std::string_view value, bool allow_unquoted)
+{
+    QuoteCounter counter;
+    append_shortened_references(counter, value);
+    if(allow_unquoted && counter.needs_quotes == false) {
+        append_shortened_references(out, value);
+        return;
+    }
+    const char quote = counter.double_quotes <= counter.single_quotes ? '"' : '\'';
+    out.append(1, quote);
+    append_shortened_references(out, value, quote);
+    out.append(1, quote);
+}
+
+/**
+ * @brief Write an attribute of `tag`, preceded by a space. Values are quoted with the quote character they do not
+ * contain, or escaped if they contain both. With Options::minify_attributes, boolean attributes lose their value,
+ * default values are removed, whitespace in `class` is collapsed and values are only quoted if they need to be.
+ * With Options::minify_entities, the character references of values are shortened
+*/
+template <typename Sink>
+constexpr void append_attribute(Sink& out, const Tag tag, const Attribute& attribute, const Options& options)
+{
+    const std::string_view name = attribute.name;
+    std::string_view value = attribute.value;
+    bool is_class = false;
+    if(options.minify_attributes) {
+        // What a placeholder renders to is unknown, a value containing one is neither dropped nor removed
+        std::optional<AttributeRule> rule;
+        if(has_placeholder(value, options) == false)
+            rule = find_attribute_rule(tag, name);
+        if(rule) {
+            if(rule->default_value.empty())
+                value = {};
+            else if(equals_ignore_case(value, rule->default_value))
+                return;
+        }
+        is_class = equals_ignore_case(name, "class");
+        if(is_class) {
+            while(value.empty() == false && is_attribute_whitespace(value.front()))
+                value.remove_prefix(1);
+            while(value.empty() == false && is_attribute_whitespace(value.back()))
+                value.remove_suffix(1);
+        }
+    }
+
+    out.append(1, ' ');
+    out.append(name);
+    if(value.empty())
+        return;
+    out.append(1, '=');
+    // What the placeholder renders to is unknown: the value keeps its quotes, or gets some, and is left as it is
+    // apart from the spaces between class names
+    if(has_placeholder(value, options)) {
+        char quote = attribute.quote;
+        if(quote == 0)
+            quote = value.find('"') == std::string_view::npos ? '"' : '\'';
+        out.append(1, quote);
+        if(is_class)
+            append_class_names(out, value);
+        else
+            out.append(value);
+        out.append(1, quote);
+        return;
+    }
+    // The quotes and whitespace such values contain are only known once they are decoded
+    if(options.minify_entities && value.find('&') != std::string_view::npos) {
+        append_shortened_value(out, value, options.minify_attributes);
+        return;
+    }
+    bool has_double_quote = value.find('"') != std::string_view::npos;
+    bool has_single_quote = value.find('\'') != std::string_view::npos;
+    // Character references could hide CSS syntax, such values are left alone
+    bool minify_style = options.minify_css && equals_ignore_case(name, "style")
+        && value.find('&') == std::string_view::npos && (has_double_quote == false || has_single_quote == false);
+    if(options.minify_attributes && minify_style == false && can_be_unquoted(value)) {
+        out.append(value);
+        return;
+    }
+
+    char quote = has_double_quote ? '\'' : '"';
+    if(has_double_quote && has_single_quote) {
+        auto double_quotes = std::count(value.begin(), value.end(), '"');
+        quote = double_quotes <= std::count(value.begin(), value.end(), '\'') ? '"' : '\'';
+    }
+    out.append(1, quote);
+    if(has_double_quote && has_single_quote)
+        append_escaped_value(out, value, quote);
+    else if(minify_style)
+        minify_style_attribute(value, out);
+    else if(is_class)
+        append_class_names(out, value);
+    else
+        out.append(value);
+    out.append(1, quote);
+}
+
+}
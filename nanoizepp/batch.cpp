@@ -0,0 +1,120 @@
+#include "nanoizepp.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp;
+using namespace nanoizepp::detail;
+
+/**
+ * @brief Order documents so that every thread's range of the pool gets a similar share of the bytes with the largest
+ * documents first: sorted by size, then dealt out round-robin into `threads` contiguous ranges
+*/
+static std::vector<size_t> schedule_by_size(const std::span<const std::string_view> documents, size_t threads)
+{
+    std::vector<size_t> by_size(documents.size());
+    std::iota(by_size.begin(), by_size.end(), size_t(0));
+    std::stable_sort(by_size.begin(), by_size.end(), [&](size_t a, size_t b) {
+        return documents[a].size() > documents[b].size();
+    });
+
+    // Same split as ThreadPool::parallel_for()
+    std::vector<size_t> order(documents.size());
+    std::vector<size_t> next(threads);
+    for(size_t t = 0; t < threads; t++)
+        next[t] = documents.size() * t / threads;
+    size_t t = 0;
+    for(size_t document : by_size) {
+        // Skip ranges that are already full (they differ in size by at most one)
+        while(next[t] == documents.size() * (t + 1) / threads)
+            t = (t + 1) % threads;
+        order[next[t]++] = document;
+        t = (t + 1) % threads;
+    }
+    return order;
+}
+
+static Options single_threaded(Options options)
+{
+    options.threads = 1;
+    return options;
+}
+
+/**
+ * @brief What a thread of the batch keeps from one document to the next. Slots are written by different threads,
+ * each has its own cache line
+*/
+struct alignas(64) BatchSlot
+{
+    // Parser scratch and output buffer of every document minimized in the slot, created by its thread
+    std::optional<Minimizer> minimizer;
+    size_t output_bytes = 0;
+};
+
+/**
+ * @brief Run `minimize(document_index, minimizer)` over the batch and fill in the timing of `stats`
+*/
+template <typename Fn>
+static BatchStats run_batch(const std::span<const std::string_view> documents, const Options& options,
+    size_t threads, Fn&& minimize)
+{
+    auto start = std::chrono::steady_clock::now();
+    auto& pool = ThreadPool::shared();
+    threads = std::min(resolve_thread_count(threads), pool.worker_count() + 1);
+    auto order = schedule_by_size(documents, threads);
+
+    const Options document_options = single_threaded(options);
+    std::vector<BatchSlot> slots(threads);
+    pool.parallel_for(documents.size(), threads, [&](size_t i, size_t slot) {
+        BatchSlot& own = slots[slot];
+        if(own.minimizer.has_value() == false)
+            own.minimizer.emplace(document_options);
+        own.output_bytes += minimize(order[i], *own.minimizer);
+    });
+
+    BatchStats stats;
+    stats.documents = documents.size();
+    for(auto document : documents)
+        stats.input_bytes += document.size();
+    for(const auto& slot : slots)
+        stats.output_bytes += slot.output_bytes;
+    stats.threads = threads;
+    stats.elapsed = std::chrono::steady_clock::now() - start;
+    return stats;
+}
+
+BatchStats nanoizepp::nanoize_batch(const std::span<const std::string_view> documents, const std::span<std::string> outputs,
+    const Options& options, size_t threads)
+{
+    if(outputs.size() != documents.size())
+        throw std::runtime_error("Nanoize++: nanoize_batch() needs one output per document");
+    return run_batch(documents, options, threads, [&](size_t index, Minimizer& minimizer) {
+        minimizer.nanoize(documents[index], outputs[index]);
+        return outputs[index].size();
+    });
+}
+
+BatchStats nanoizepp::nanoize_batch(const std::span<const std::string_view> documents,
+    const std::function<void(size_t, std::string_view)>& callback, const Options& options, size_t threads)
+{
+    return run_batch(documents, options, threads, [&](size_t index, Minimizer& minimizer) {
+        std::string_view output = minimizer.nanoize(documents[index]);
+        callback(index, output);
+        return output.size();
+    });
+}
+
+std::vector<std::string> nanoizepp::nanoize_batch(const std::span<const std::string_view> documents, const Options& options,
+    size_t threads)
+{
+    std::vector<std::string> outputs(documents.size());
+    nanoize_batch(documents, std::span<std::string>(outputs), options, threads);
+    return outputs;
+}
@@ -0,0 +1,266 @@
+#include "nanoizepp.hpp"
+#include "hash.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace nanoizepp;
+using namespace nanoizepp::detail;
+
+namespace
+{
+
+// Bookkeeping charged to every entry on top of its output, so a flood of tiny documents is bounded too
+constexpr size_t entry_overhead = 128;
+// An entry has to fit in one shard: shards are never made smaller than this, unless the whole cache is
+constexpr size_t min_shard_budget = 1024 * 1024;
+
+struct KeyHash
+{
+    size_t operator()(const Hash128& key) const { return size_t(key.high); }
+};
+
+struct Entry
+{
+    Hash128 key;
+    // The document the output was made from, compared on every hit so that a hash collision cannot hand out the
+    // output of another document
+    std::string input;
+    std::shared_ptr<const std::string> value;
+    size_t cost = 0;
+    // Set on every hit, cleared when the CLOCK hand passes
+    mutable std::atomic<bool> referenced{false};
+};
+
+/**
+ * @brief Independently locked part of the cache. Hits only take the lock shared, so lookups of popular documents
+ * from many threads do not serialize
+*/
+struct alignas(64) Shard
+{
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Hash128, uint32_t, KeyHash> index;
+    // Entries never move, evicted ones are recycled through `free_slots`
+    std::deque<Entry> slots;
+    std::vector<uint32_t> free_slots;
+    size_t hand = 0;
+    // Costs of the entries: outputs, inputs and overhead
+    size_t bytes = 0;
+    size_t output_bytes = 0;
+    size_t budget = 0;
+
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+    std::atomic<size_t> evictions{0};
+
+    std::shared_ptr<const std::string> find(const Hash128& key, const std::string_view html) const
+    {
+        std::shared_lock lock(mutex);
+        auto it = index.find(key);
+        if(it == index.end() || slots[it->second].input != html)
+            return nullptr;
+        const Entry& entry = slots[it->second];
+        if(entry.referenced.load(std::memory_order_relaxed) == false)
+            entry.referenced.store(true, std::memory_order_relaxed);
+        return entry.value;
+    }
+
+    /**
+     * @brief Add `value`, the output of `html`, unless another thread added the same document meanwhile, in which
+     * case that one is returned. A different document with the same key keeps its entry
+    */
+    std::shared_ptr<const std::string> insert(const Hash128& key, const std::string_view html,
+        std::shared_ptr<const std::string> value)
+    {
+        size_t cost = value->size() + html.size() + entry_overhead;
+        if(cost > budget)
+            return value;
+
+        std::unique_lock lock(mutex);
+        auto it = index.find(key);
+        if(it != index.end())
+            return slots[it->second].input == html ? slots[it->second].value : value;
+
+        while(bytes + cost > budget)
+            evict_one();
+
+        uint32_t slot;
+        if(free_slots.empty() == false) {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        }
+        else {
+            slot = uint32_t(slots.size());
+            slots.emplace_back();
+        }
+        Entry& entry = slots[slot];
+        entry.key = key;
+        entry.input.assign(html);
+        entry.value = value;
+        entry.cost = cost;
+        entry.referenced.store(false, std::memory_order_relaxed);
+        index.emplace(key, slot);
+        bytes += cost;
+        output_bytes += value->size();
+        return value;
+    }
+
+    /**
+     * @brief CLOCK: sweep the hand over the entries, giving referenced ones a second chance
+    */
+    void evict_one()
+    {
+        while(true) {
+            if(hand >= slots.size())
+                hand = 0;
+            Entry& entry = slots[hand++];
+            if(entry.value == nullptr)
+                continue;
+            if(entry.referenced.exchange(false, std::memory_order_relaxed))
+                continue;
+            index.erase(entry.key);
+            bytes -= entry.cost;
+            output_bytes -= entry.value->size();
+            entry.input = std::string();
+            entry.value.reset();
+            free_slots.push_back(uint32_t(hand - 1));
+            evictions.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    void clear()
+    {
+        std::unique_lock lock(mutex);
+        index.clear();
+        slots.clear();
+        free_slots.clear();
+        hand = 0;
+        bytes = 0;
+        output_bytes = 0;
+    }
+};
+
+size_t default_shard_count()
+{
+    size_t threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    return std::max<size_t>(std::bit_ceil(threads * 4), 16);
+}
+
+/**
+ * @brief `requested` shards (0 for the default), fewer if the shards would get less than min_shard_budget each
+*/
+size_t shard_count(size_t max_bytes, size_t requested)
+{
+    size_t count = std::bit_ceil(requested == 0 ? default_shard_count() : requested);
+    return std::min(count, std::bit_floor(std::max<size_t>(max_bytes / min_shard_budget, 1)));
+}
+
+Hash128 cache_key(const std::string_view html, const Options& options)
+{
+    // Engine and thread count do not change the output, so they are not part of the key. The seed is different in
+    // every process, so documents cannot be crafted in advance to fall on the same entries
+    uint64_t seed = uint64_t(options.indent) * 64 + (options.newline ? 1 : 0) + (options.minify_css ? 2 : 0)
+        + (options.minify_js ? 4 : 0) + (options.minify_attributes ? 8 : 0) + (options.minify_entities ? 16 : 0)
+        + (options.placeholder_markers ? 32 : 0);
+    // Flattening changes the output, the other limits stop minimization. A document cached without them must not be
+    // handed to a caller that set them, so the depth and node limits are part of the key. The output limit is checked
+    // against the cached output instead, see check_output_limit()
+    if(options.max_depth != 0)
+        seed ^= multiply_fold(uint64_t(options.max_depth) * 2 + (options.flatten_deep_nesting ? 1 : 0),
+            0x9E3779B97F4A7C15ull);
+    if(options.max_nodes != 0)
+        seed ^= multiply_fold(uint64_t(options.max_nodes), 0xC2B2AE3D27D4EB4Full);
+    return hash128(html, process_seed() ^ seed);
+}
+
+/**
+ * @brief Throw like nanoize() if the cached `output` is larger than Options::max_output
+*/
+const std::shared_ptr<const std::string>& check_output_limit(const std::shared_ptr<const std::string>& output,
+    const Options& options)
+{
+    if(output != nullptr && options.max_output != 0 && output->size() > options.max_output)
+        throw LimitExceeded(Limit::Output, "Nanoize++: The output is larger than Options::max_output");
+    return output;
+}
+
+}
+
+struct NanoizeCache::Impl
+{
+    std::unique_ptr<Shard[]> shards;
+    size_t shard_mask = 0;
+
+    Shard& shard_for(const Hash128& key) const
+    {
+        return shards[key.low & shard_mask];
+    }
+};
+
+NanoizeCache::NanoizeCache(size_t max_bytes, size_t shards)
+    : impl(std::make_unique<Impl>())
+{
+    size_t count = shard_count(max_bytes, shards);
+    impl->shards = std::make_unique<Shard[]>(count);
+    impl->shard_mask = count - 1;
+    for(size_t i = 0; i < count; i++)
+        impl->shards[i].budget = max_bytes / count;
+}
+
+NanoizeCache::~NanoizeCache() = default;
+NanoizeCache::NanoizeCache(NanoizeCache&&) noexcept = default;
+NanoizeCache& NanoizeCache::operator=(NanoizeCache&&) noexcept = default;
+
+std::shared_ptr<const std::string> NanoizeCache::nanoize(std::string_view html, const Options& options)
+{
+    Hash128 key = cache_key(html, options);
+    Shard& shard = impl->shard_for(key);
+    if(auto value = shard.find(key, html)) {
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        return check_output_limit(value, options);
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+
+    // Minimized without holding the lock, two threads missing on the same document may both do the work
+    auto value = std::make_shared<std::string>();
+    nanoizepp::nanoize(html, *value, options);
+    return shard.insert(key, html, std::move(value));
+}
+
+std::shared_ptr<const std::string> NanoizeCache::find(std::string_view html, const Options& options) const
+{
+    Hash128 key = cache_key(html, options);
+    return check_output_limit(impl->shard_for(key).find(key, html), options);
+}
+
+CacheStats NanoizeCache::stats() const
+{
+    CacheStats stats;
+    for(size_t i = 0; i <= impl->shard_mask; i++) {
+        const Shard& shard = impl->shards[i];
+        stats.hits += shard.hits.load(std::memory_order_relaxed);
+        stats.misses += shard.misses.load(std::memory_order_relaxed);
+        stats.evictions += shard.evictions.load(std::memory_order_relaxed);
+        std::shared_lock lock(shard.mutex);
+        stats.entries += shard.index.size();
+        stats.bytes += shard.output_bytes;
+    }
+    return stats;
+}
+
+void NanoizeCache::clear()
+{
+    for(size_t i = 0; i <= impl->shard_mask; i++)
+        impl->shards[i].clear();
+}
@@ -0,0 +1,127 @@
+#include "compress.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace nanoizepp;
+
+namespace
+{
+
+// Size of the blocks of compressed output passed to callbacks
+constexpr size_t output_block_size = 16 * 1024;
+
+// zlib allocates its state through these, so it is counted like the rest of the library's memory
+voidpf allocate(voidpf, uInt items, uInt size)
+{
+    return ::operator new(size_t(items) * size, std::nothrow);
+}
+
+void deallocate(voidpf, voidpf address)
+{
+    ::operator delete(address);
+}
+
+}
+
+struct Compressor::Impl
+{
+    z_stream stream{};
+    std::unique_ptr<char[]> block = std::make_unique<char[]>(output_block_size);
+
+    explicit Impl(const CompressionOptions& options)
+    {
+        stream.zalloc = allocate;
+        stream.zfree = deallocate;
+        // 15 bits of window, plus 16 to get a gzip header and trailer instead of the zlib ones
+        int window_bits = options.format == CompressionFormat::Gzip ? 15 + 16 : 15;
+        int level = std::clamp(options.level, 1, 9);
+        if(deflateInit2(&stream, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::runtime_error("Nanoize++: cannot initialize zlib");
+    }
+
+    ~Impl()
+    {
+        deflateEnd(&stream);
+    }
+
+    /**
+     * @brief Compress `data` with `flush`, until zlib has nothing more to output
+    */
+    void deflate_all(std::string_view data, int flush, const std::function<void(std::string_view)>& callback)
+    {
+        do {
+            // avail_in is 32 bits
+            size_t chunk = std::min<size_t>(data.size(), std::numeric_limits<uInt>::max());
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+            stream.avail_in = uInt(chunk);
+            data.remove_prefix(chunk);
+            const int chunk_flush = data.empty() ? flush : Z_NO_FLUSH;
+            int result = Z_OK;
+            do {
+                stream.next_out = reinterpret_cast<Bytef*>(block.get());
+                stream.avail_out = uInt(output_block_size);
+                result = deflate(&stream, chunk_flush);
+                if(result == Z_STREAM_ERROR)
+                    throw std::runtime_error("Nanoize++: zlib compression failed");
+                size_t produced = output_block_size - stream.avail_out;
+                if(produced != 0)
+                    callback(std::string_view(block.get(), produced));
+            } while(stream.avail_out == 0 || (chunk_flush == Z_FINISH && result != Z_STREAM_END));
+        } while(data.empty() == false);
+    }
+};
+
+Compressor::Compressor(const CompressionOptions& options) : impl(std::make_unique<Impl>(options))
+{
+}
+
+Compressor::~Compressor() = default;
+Compressor::Compressor(Compressor&&) noexcept = default;
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+void Compressor::write(const std::string_view data, const std::function<void(std::string_view)>& callback)
+{
+    if(data.empty() == false)
+        impl->deflate_all(data, Z_NO_FLUSH, callback);
+}
+
+void Compressor::flush(const std::function<void(std::string_view)>& callback)
+{
+    impl->deflate_all({}, Z_SYNC_FLUSH, callback);
+}
+
+void Compressor::finish(const std::function<void(std::string_view)>& callback)
+{
+    impl->deflate_all({}, Z_FINISH, callback);
+    deflateReset(&impl->stream);
+}
+
+void nanoizepp::nanoize_compressed(const std::string_view html, const std::function<void(std::string_view)>& callback,
+    const Options& options, const CompressionOptions& compression)
+{
+    Compressor compressor(compression);
+    // The minimized output arrives in blocks of a few KiB, a good size for zlib
+    nanoize(html, std::function<void(std::string_view)>([&](std::string_view block) {
+        compressor.write(block, callback);
+    }), options);
+    compressor.finish(callback);
+}
+
+void nanoizepp::nanoize_compressed(const std::string_view html, std::string& out, const Options& options,
+    const CompressionOptions& compression)
+{
+    out.clear();
+    // HTML usually compresses to a fifth of its size or less
+    out.reserve(html.size() / 4 + 64);
+    nanoize_compressed(html, std::function<void(std::string_view)>([&](std::string_view block) {
+        out.append(block);
+    }), options, compression);
+}
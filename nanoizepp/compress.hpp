@@ -0,0 +1,84 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+
+#ifndef NANOIZEPP_HAS_ZLIB
+#error "Nanoize++ was built without zlib, configure it with -DNANOIZEPP_WITH_ZLIB=ON to use compressed output"
+#endif
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace nanoizepp
+{
+
+enum class CompressionFormat
+{
+    // Content-Encoding: gzip
+    Gzip,
+    // Content-Encoding: deflate, which is the zlib format
+    Deflate,
+};
+
+struct CompressionOptions
+{
+    CompressionFormat format = CompressionFormat::Gzip;
+    // zlib compression level, from 1 (fastest) to 9 (smallest). 6 suits responses compressed per request, use 9 for
+    // assets compressed once
+    int level = 6;
+};
+
+/**
+ * @brief Incremental gzip/deflate encoder
+ *
+ * Compressed output is passed to a callback in blocks as soon as zlib produces it. After finish() the compressor
+ * starts a new stream, so one can be kept per thread and reused for every response.
+*/
+class Compressor
+{
+public:
+    explicit Compressor(const CompressionOptions& options = {});
+    ~Compressor();
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+
+    /**
+     * @brief Compress `data`. zlib keeps some of it back to compress better, it comes out with later calls
+    */
+    void write(std::string_view data, const std::function<void(std::string_view)>& callback);
+
+    /**
+     * @brief Pass everything written so far to `callback`, at the cost of a few bytes of compression. Use it to
+     * send the start of a page while the rest is still being generated
+    */
+    void flush(const std::function<void(std::string_view)>& callback);
+
+    /**
+     * @brief End the stream and get ready for the next one
+    */
+    void finish(const std::function<void(std::string_view)>& callback);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * @brief Miniaturize HTML and compress it in the same pass, passing the compressed output to `callback` in blocks
+ *
+ * The minimized document is fed to the compressor a block at a time instead of being held in full, which saves a
+ * pass over memory and the memory of the minimized copy.
+*/
+void nanoize_compressed(std::string_view html, const std::function<void(std::string_view)>& callback,
+    const Options& options = {}, const CompressionOptions& compression = {});
+
+/**
+ * @brief Miniaturize and compress HTML into a caller-owned buffer, for example to produce precompressed assets. The
+ * previous content of `out` is replaced but its capacity is kept
+*/
+void nanoize_compressed(std::string_view html, std::string& out, const Options& options = {},
+    const CompressionOptions& compression = {});
+
+}
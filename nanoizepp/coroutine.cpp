@@ -0,0 +1,30 @@
+#include "coroutine.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+using namespace nanoizepp;
+
+ChunkGenerator nanoizepp::nanoize_chunks(std::string_view html, const Options options, size_t chunk_size)
+{
+    chunk_size = std::max<size_t>(chunk_size, 1);
+    // The streaming minimizer keeps the parser state between slices and holds back unfinished constructs
+    StreamNanoizer stream(options);
+    std::string output;
+    bool finished = false;
+    while(finished == false) {
+        if(html.empty()) {
+            output = stream.finish();
+            finished = true;
+        }
+        else {
+            size_t slice = std::min(chunk_size, html.size());
+            output = stream.feed(html.substr(0, slice));
+            html.remove_prefix(slice);
+        }
+        // Indentation can make the output of a slice larger than the slice
+        for(size_t start = 0; start < output.size(); start += chunk_size)
+            co_yield std::string_view(output).substr(start, chunk_size);
+    }
+}
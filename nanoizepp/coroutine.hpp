@@ -0,0 +1,129 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace nanoizepp
+{
+
+/**
+ * @brief Minimized output of a document, produced one chunk at a time as it is pulled
+ *
+ * The work happens inside next(): nothing is minimized ahead of what the caller asks for, so a server can send each
+ * chunk before producing the next one, interleave the chunks of several documents on one thread, and stop pulling
+ * while a slow client drains its socket. Each chunk is only valid until the next call to next(). It is also an
+ * input range, for use in a range-based for loop.
+*/
+class ChunkGenerator
+{
+public:
+    struct promise_type
+    {
+        std::string_view chunk;
+        std::exception_ptr exception;
+
+        ChunkGenerator get_return_object()
+        {
+            return ChunkGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        // Lazy: the document is only touched once the first chunk is asked for
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(std::string_view value) noexcept
+        {
+            chunk = value;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { exception = std::current_exception(); }
+    };
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        std::string_view operator*() const { return generator->chunk(); }
+        iterator& operator++()
+        {
+            if(generator->next() == false)
+                generator = nullptr;
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return generator == nullptr; }
+
+    private:
+        friend class ChunkGenerator;
+        explicit iterator(ChunkGenerator* generator) : generator(generator) {}
+        ChunkGenerator* generator = nullptr;
+    };
+
+    ChunkGenerator(ChunkGenerator&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    ChunkGenerator& operator=(ChunkGenerator&& other) noexcept
+    {
+        if(this != &other) {
+            if(handle)
+                handle.destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+    ~ChunkGenerator()
+    {
+        if(handle)
+            handle.destroy();
+    }
+
+    /**
+     * @brief Minimize up to the next chunk
+     * @return false once the whole document has been produced. Exceptions thrown while minimizing are rethrown here
+    */
+    bool next()
+    {
+        if(handle == nullptr || handle.done())
+            return false;
+        handle.resume();
+        if(handle.promise().exception)
+            std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+        return handle.done() == false;
+    }
+
+    /**
+     * @brief The chunk produced by the last call to next() that returned true
+    */
+    std::string_view chunk() const { return handle.promise().chunk; }
+
+    iterator begin()
+    {
+        iterator it(this);
+        return next() ? it : iterator();
+    }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    explicit ChunkGenerator(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+    std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief Miniaturize HTML a chunk at a time
+ *
+ * The input is parsed in slices of `chunk_size` bytes and the output is produced in chunks of at most `chunk_size`
+ * bytes, so each call to next() does an amount of work bounded by the chunk size (a construct longer than that, like
+ * a large script, is finished in the call that reaches its end). The concatenated chunks are identical to nanoize().
+ * `html` must stay valid until the generator is done or destroyed, `options` is copied.
+ * @param options Output options, the engine and thread count are ignored
+*/
+ChunkGenerator nanoize_chunks(std::string_view html, Options options = {}, size_t chunk_size = 16 * 1024);
+
+}
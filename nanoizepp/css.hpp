@@ -0,0 +1,459 @@
+#pragma once
+
+#include "tags.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+namespace css
+{
+
+enum CharClass : uint8_t
+{
+    // Characters that need a look: whitespace, punctuation and the start of comments, strings, escapes, zeros,
+    // colors and url()
+    Special = 1,
+    // Letters, digits, '-', '_', non-ASCII and escapes: characters that continue a name or a number
+    NameChar = 2,
+};
+
+constexpr std::array<uint8_t, 256> make_char_classes()
+{
+    std::array<uint8_t, 256> classes{};
+    for(int c = 0; c < 256; c++) {
+        if((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_'
+            || c == '\\' || c >= 0x80)
+            classes[c] |= NameChar;
+    }
+    for(unsigned char c : std::string_view(" \t\n\r\f/\"'\\{};:(),!0#uU"))
+        classes[c] |= Special;
+    return classes;
+}
+
+inline constexpr std::array<uint8_t, 256> char_classes = make_char_classes();
+
+constexpr bool is_special(char c) { return char_classes[(unsigned char)c] & Special; }
+constexpr bool is_name_char(char c) { return char_classes[(unsigned char)c] & NameChar; }
+constexpr bool is_space(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
+
+constexpr bool is_hex_digit(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+/**
+ * @brief Units a zero length can go without. Not %, times, angles or resolutions: a unitless 0 is not valid for
+ * those everywhere
+*/
+constexpr bool is_length_unit(const std::string_view unit)
+{
+    for(std::string_view known : {"px", "em", "rem", "ex", "ch", "vw", "vh", "vmin", "vmax", "cm", "mm", "q", "in",
+            "pt", "pc"}) {
+        if(equals_ignore_case(unit, known))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief End of the quoted string starting at `start` (past the closing quote, or the end of the text)
+*/
+constexpr size_t skip_string(const std::string_view text, size_t start)
+{
+    const char quote = text[start];
+    size_t i = start + 1;
+    while(i < text.size() && text[i] != quote)
+        i += text[i] == '\\' ? 2 : 1;
+    return std::min(i + 1, text.size());
+}
+
+/**
+ * @brief End of the comment starting at `start` (past the `*` `/`, or the end of the text)
+*/
+constexpr size_t skip_comment(const std::string_view text, size_t start)
+{
+    auto end = text.find("*/", start + 2);
+    return end == std::string_view::npos ? text.size() : end + 2;
+}
+
+/**
+ * @brief The first `;`, `{` or `}` at or after `start` outside strings and comments, the end of the text if there is
+ * none
+*/
+constexpr size_t statement_end(const std::string_view text, size_t start)
+{
+    size_t i = start;
+    while(i < text.size()) {
+        i = text.find_first_of(";{}\"'/", i);
+        if(i == std::string_view::npos)
+            return text.size();
+        if(text[i] == '"' || text[i] == '\'')
+            i = skip_string(text, i);
+        else if(text[i] == '/' && i + 1 < text.size() && text[i + 1] == '*')
+            i = skip_comment(text, i);
+        else if(text[i] == '/')
+            i++;
+        else
+            return i;
+    }
+    return text.size();
+}
+
+}
+
+/**
+ * @brief Single pass CSS minifier writing straight to a sink, without allocating
+ *
+ * Removes comments (except the ones starting with `!`, usually licenses), whitespace that does not separate tokens
+ * and the last semicolon of each block. In declarations it also drops the unit of zero lengths (`0px` to `0`) and shortens
+ * colors like `#aabbcc` to `#abc`. Strings and url() are copied as they are, custom property values only have
+ * comments removed and whitespace collapsed, and zero lengths keep their unit inside functions (calc() requires
+ * it) and in `flex` (where `0` would be read as a flex factor). A colon followed by a `{` before the next `;` is
+ * part of a selector, so values are never rewritten in selectors, nested ones included.
+*/
+template <typename Sink>
+class CssMinifier
+{
+public:
+    explicit CssMinifier(Sink& out) : out(out) {}
+
+    /**
+     * @brief Minify the content of a <style> element
+    */
+    void stylesheet(const std::string_view css)
+    {
+        run(css, false);
+    }
+
+    /**
+     * @brief Minify the value of a style attribute, a list of declarations
+    */
+    void declarations(const std::string_view css)
+    {
+        run(css, true);
+    }
+
+private:
+    void run(const std::string_view css, bool declarations_only)
+    {
+        text = css;
+        copy = {};
+        in_declarations = declarations_only;
+        depth = 0;
+        last = '\0';
+        pending_space = false;
+        pending_semicolon = false;
+        start_statement(0);
+        size_t i = 0;
+        while(i < text.size())
+            i = step(i);
+        // A semicolon still pending is not needed, nothing follows it
+        flush();
+    }
+
+    void start_statement(size_t position)
+    {
+        statement_start = position;
+        in_value = false;
+        after_value_colon = false;
+        keep_units = false;
+        verbatim = false;
+        paren_depth = 0;
+        lookahead_end = 0;
+    }
+
+    /**
+     * @brief Handle the token at `i`
+     * @return Position of the next token
+    */
+    size_t step(size_t i)
+    {
+        const char c = text[i];
+        if(css::is_special(c) == false) {
+            size_t end = i + 1;
+            while(end < text.size() && css::is_special(text[end]) == false)
+                end++;
+            write(text.substr(i, end - i));
+            return end;
+        }
+
+        if(css::is_space(c)) {
+            pending_space = true;
+            return i + 1;
+        }
+        switch(c) {
+        case '/':
+            if(i + 1 < text.size() && text[i + 1] == '*') {
+                size_t end = css::skip_comment(text, i);
+                if(i + 2 < text.size() && text[i + 2] == '!')
+                    write(text.substr(i, end - i));
+                else
+                    pending_space = true;
+                return end;
+            }
+            break;
+        case '"':
+        case '\'': {
+            size_t end = css::skip_string(text, i);
+            write(text.substr(i, end - i));
+            return end;
+        }
+        case '\\':
+            write(text.substr(i, 2));
+            return i + 2;
+        case 'u':
+        case 'U':
+            if(equals_ignore_case(text.substr(i, 4), "url(") && (i == 0 || css::is_name_char(text[i - 1]) == false))
+                return copy_url(i);
+            break;
+        case '{':
+            pending_space = false;
+            write(text.substr(i, 1));
+            depth++;
+            start_statement(i + 1);
+            return i + 1;
+        case '}':
+            pending_space = false;
+            write(text.substr(i, 1));
+            if(depth != 0)
+                depth--;
+            start_statement(i + 1);
+            return i + 1;
+        case ';':
+            pending_space = false;
+            // `;;` is one semicolon, and the one before a `}` is not needed. A style attribute may start with one
+            if(pending_semicolon == false && (last != '\0' || in_declarations == false))
+                pending_semicolon = true;
+            start_statement(i + 1);
+            return i + 1;
+        case '(':
+            paren_depth++;
+            break;
+        case ')':
+            if(paren_depth != 0)
+                paren_depth--;
+            break;
+        case ':':
+            if(is_value_colon(i)) {
+                pending_space = false;
+                begin_value(i);
+                write(text.substr(i, 1));
+                after_value_colon = true;
+                return i + 1;
+            }
+            break;
+        case '0':
+            if(rewrites_values() && paren_depth == 0 && keep_units == false)
+                return write_zero(i);
+            break;
+        case '#':
+            if(rewrites_values())
+                return write_hash(i);
+            break;
+        }
+        write(text.substr(i, 1));
+        return i + 1;
+    }
+
+    bool rewrites_values() const { return in_value && verbatim == false; }
+
+    /**
+     * @brief true if the colon at `i` separates a property from its value
+    */
+    bool is_value_colon(size_t i)
+    {
+        if(in_value || paren_depth != 0 || (depth == 0 && in_declarations == false))
+            return false;
+        // One lookahead per statement, the colons of a long selector share it
+        if(lookahead_end <= i)
+            lookahead_end = css::statement_end(text, i);
+        return lookahead_end == text.size() || text[lookahead_end] != '{';
+    }
+
+    void begin_value(size_t colon)
+    {
+        in_value = true;
+        std::string_view name = text.substr(statement_start, colon - statement_start);
+        while(name.empty() == false && css::is_space(name.front()))
+            name.remove_prefix(1);
+        while(name.empty() == false && css::is_space(name.back()))
+            name.remove_suffix(1);
+        verbatim = name.starts_with("--");
+        keep_units = name.size() >= 4 && equals_ignore_case(name.substr(name.size() - 4), "flex");
+    }
+
+    /**
+     * @brief Write a `0` that starts a number, without the unit if it is a length
+    */
+    size_t write_zero(size_t i)
+    {
+        // Part of a longer number or name (`10px`, `a0`, `.0`)?
+        if(pending_space == false
+            && (css::is_name_char(last) || last == '.' || last == '#' || last == '%' || last == '+'))
+            return write_plain(i);
+        size_t unit_end = i + 1;
+        while(unit_end < text.size() && ((text[unit_end] >= 'a' && text[unit_end] <= 'z')
+            || (text[unit_end] >= 'A' && text[unit_end] <= 'Z')))
+            unit_end++;
+        bool ends_number = unit_end == text.size()
+            || (css::is_name_char(text[unit_end]) == false && text[unit_end] != '.' && text[unit_end] != '%'
+                && text[unit_end] != '(');
+        auto unit = text.substr(i + 1, unit_end - i - 1);
+        if(unit.empty() || ends_number == false || css::is_length_unit(unit) == false)
+            return write_plain(i);
+        write(text.substr(i, 1));
+        return unit_end;
+    }
+
+    /**
+     * @brief Write a hash, shortened if it is a color whose digits come in pairs
+    */
+    size_t write_hash(size_t i)
+    {
+        size_t end = i + 1;
+        while(end < text.size() && css::is_hex_digit(text[end]))
+            end++;
+        size_t digits = end - i - 1;
+        bool color = (digits == 6 || digits == 8) && (end == text.size() || css::is_name_char(text[end]) == false);
+        if(color) {
+            for(size_t d = i + 1; d < end; d += 2) {
+                if(to_lower_ascii(text[d]) != to_lower_ascii(text[d + 1])) {
+                    color = false;
+                    break;
+                }
+            }
+        }
+        if(color == false) {
+            write(text.substr(i, end - i));
+            return end;
+        }
+        char shortened[5] = {'#'};
+        for(size_t d = 0; d < digits / 2; d++)
+            shortened[d + 1] = text[i + 1 + d * 2];
+        write(std::string_view(shortened, 1 + digits / 2), false);
+        return end;
+    }
+
+    size_t write_plain(size_t i)
+    {
+        write(text.substr(i, 1));
+        return i + 1;
+    }
+
+    /**
+     * @brief Copy `url(...)` as it is, an unquoted URL may contain anything but `)`
+    */
+    size_t copy_url(size_t i)
+    {
+        size_t end = i + 4;
+        while(end < text.size() && text[end] != ')') {
+            if(text[end] == '"' || text[end] == '\'')
+                end = css::skip_string(text, end);
+            else
+                end += text[end] == '\\' ? 2 : 1;
+        }
+        end = std::min(end + 1, text.size());
+        write(text.substr(i, end - i));
+        return end;
+    }
+
+    /**
+     * @brief Write `s`, preceded by the pending semicolon and space if they are still needed
+     * @param in_text `s` points into the text, it can be merged with the neighbouring copies
+    */
+    void write(const std::string_view s, bool in_text = true)
+    {
+        const char next = s[0];
+        if(pending_semicolon) {
+            pending_semicolon = false;
+            if(next != '}') {
+                flush();
+                out.append(1, ';');
+                last = ';';
+            }
+        }
+        if(pending_space) {
+            pending_space = false;
+            if(space_needed(next)) {
+                flush();
+                out.append(1, ' ');
+            }
+        }
+        if(in_text && copy.empty() == false && copy.data() + copy.size() == s.data())
+            copy = std::string_view(copy.data(), copy.size() + s.size());
+        else {
+            flush();
+            if(in_text)
+                copy = s;
+            else
+                out.append(s);
+        }
+        last = s.back();
+        after_value_colon = false;
+    }
+
+    /**
+     * @brief Write the text copied as it is so far
+    */
+    void flush()
+    {
+        if(copy.empty() == false)
+            out.append(copy);
+        copy = {};
+    }
+
+    bool space_needed(char next) const
+    {
+        if(last == '\0' || after_value_colon)
+            return false;
+        if(verbatim)
+            return next != ';' && next != '}';
+        constexpr std::string_view before_or_after = "{};,";
+        return before_or_after.find(last) == std::string_view::npos && last != '('
+            && before_or_after.find(next) == std::string_view::npos && next != ')' && next != '!';
+    }
+
+    Sink& out;
+    std::string_view text;
+    // Output not written yet, a part of `text` that is copied unchanged
+    std::string_view copy;
+    // Parsing a style attribute, declarations are allowed outside blocks
+    bool in_declarations = false;
+    size_t depth = 0;
+    // Last character written, 0 if none
+    char last = '\0';
+    bool pending_space = false;
+    bool pending_semicolon = false;
+
+    // Current statement (declaration, rule prelude or at-rule)
+    size_t statement_start = 0;
+    bool in_value = false;
+    bool after_value_colon = false;
+    // Zero lengths keep their unit (flex)
+    bool keep_units = false;
+    // Custom property, the value is kept as written
+    bool verbatim = false;
+    size_t paren_depth = 0;
+    // Where the last lookahead for the end of the statement stopped
+    size_t lookahead_end = 0;
+};
+
+template <typename Sink>
+void minify_css(const std::string_view css, Sink& out)
+{
+    CssMinifier<Sink>(out).stylesheet(css);
+}
+
+template <typename Sink>
+void minify_style_attribute(const std::string_view css, Sink& out)
+{
+    CssMinifier<Sink>(out).declarations(css);
+}
+
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+#include "attributes.hpp"
+#include "css.hpp"
+#include "js.hpp"
+#include "parser.hpp"
+#include "references.hpp"
+#include "sink.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <span>
+
+namespace nanoizepp::detail
+{
+
+template <typename Sink>
+constexpr void append_start_tag(Sink& out, const Tag tag, const std::span<const Attribute> attributes,
+    const Options& options)
+{
+    out.append(1, '<');
+    out.append(tag.name);
+    for(const auto& attribute : attributes)
+        append_attribute(out, tag, attribute, options);
+    out.append(1, '>');
+}
+
+/**
+ * @brief How the text of an element is minified
+*/
+enum class TextKind : uint8_t
+{
+    // Copied as it is
+    Plain,
+    // Text of normal elements, with its character references shortened
+    Html,
+    Css,
+    JavaScript,
+    Json,
+};
+
+constexpr std::string_view find_attribute(const std::span<const Attribute> attributes, const std::string_view name)
+{
+    for(const auto& attribute : attributes) {
+        if(equals_ignore_case(attribute.name, name))
+            return attribute.value;
+    }
+    return {};
+}
+
+constexpr bool has_attribute(const std::span<const Attribute> attributes, const std::string_view name)
+{
+    return std::any_of(attributes.begin(), attributes.end(),
+        [&](const Attribute& attribute) { return equals_ignore_case(attribute.name, name); });
+}
+
+constexpr std::string_view trim_ascii_whitespace(std::string_view sv)
+{
+    constexpr std::string_view whitespace = " \t\n\r\f";
+    auto start = sv.find_first_not_of(whitespace);
+    if(start == std::string_view::npos)
+        return {};
+    return sv.substr(start, sv.find_last_not_of(whitespace) + 1 - start);
+}
+
+/**
+ * @brief What the text of the raw text element `tag` contains, Plain unless the options minify it. Like browsers,
+ * only the exact JavaScript MIME types count as JavaScript, `text/javascript; charset=utf-8` is not run
+*/
+constexpr TextKind raw_text_kind(const Tag tag, const std::span<const Attribute> attributes, const Options& options)
+{
+    if(tag.id == style_tag && options.minify_css) {
+        auto type = trim_ascii_whitespace(find_attribute(attributes, "type"));
+        return type.empty() || equals_ignore_case(type, "text/css") ? TextKind::Css : TextKind::Plain;
+    }
+    // The content of an external script is not run, but pages use it to hold data
+    if(tag.id != script_tag || options.minify_js == false || has_attribute(attributes, "src"))
+        return TextKind::Plain;
+
+    auto type = trim_ascii_whitespace(find_attribute(attributes, "type"));
+    if(type.empty()) {
+        auto language = find_attribute(attributes, "language");
+        return language.empty() || equals_ignore_case(language, "javascript") ? TextKind::JavaScript
+            : TextKind::Plain;
+    }
+    for(std::string_view javascript : {"module", "text/javascript", "application/javascript", "text/ecmascript",
+            "application/ecmascript", "application/x-javascript", "text/x-javascript", "application/x-ecmascript",
+            "text/x-ecmascript", "text/jscript", "text/livescript"}) {
+        if(equals_ignore_case(type, javascript))
+            return TextKind::JavaScript;
+    }
+    for(std::string_view json : {"application/json", "importmap", "speculationrules"}) {
+        if(equals_ignore_case(type, json))
+            return TextKind::Json;
+    }
+    // application/ld+json and the other JSON based formats
+    if(type.size() > 5 && equals_ignore_case(type.substr(type.size() - 5), "+json")
+        && type.find_first_of(" ;") == std::string_view::npos)
+        return TextKind::Json;
+    return TextKind::Plain;
+}
+
+/**
+ * @brief How the text of normal elements is written
+*/
+constexpr TextKind html_text_kind(const Options& options)
+{
+    return options.minify_entities ? TextKind::Html : TextKind::Plain;
+}
+
+/**
+ * @brief `kind`, or Plain if `text` contains a placeholder: minifying the text around it could change what the
+ * rendered template means
+*/
+constexpr TextKind placeholder_text_kind(const TextKind kind, const std::string_view text, const Options& options)
+{
+    return has_placeholder(text, options) ? TextKind::Plain : kind;
+}
+
+/**
+ * @brief Write the text of an element, minified as `kind`
+*/
+template <typename Sink>
+constexpr void append_text(Sink& out, const TextKind kind, const std::string_view text)
+{
+    switch(kind) {
+    case TextKind::Plain:
+        out.append(text);
+        break;
+    case TextKind::Html:
+        // CDATA sections are reported as text, references are not decoded in them
+        if(text.find('&') == std::string_view::npos || text.starts_with("<![CDATA["))
+            out.append(text);
+        else
+            append_shortened_references(out, text);
+        break;
+    case TextKind::Css:
+        minify_css(text, out);
+        break;
+    case TextKind::JavaScript:
+        compact_javascript(text, out);
+        break;
+    case TextKind::Json:
+        compact_json(text, out);
+        break;
+    }
+}
+
+template <typename Sink>
+constexpr void append_end_tag(Sink& out, const Tag tag)
+{
+    out.append("</");
+    out.append(tag.name);
+    out.append(1, '>');
+}
+
+/**
+ * @brief Parser handler that writes the minimized HTML as soon as the parser reports it, without building a tree
+*/
+template <typename Sink>
+class Emitter
+{
+public:
+    /**
+     * @param depth Number of elements already open, when emitting a part of a document
+    */
+    constexpr Emitter(Sink& out, const Options& options, size_t depth = 0)
+        : out(out), options(options), indent(options.indent), newline(options.newline), depth(depth)
+    {
+    }
+
+    /**
+     * @brief Start over with a new document
+    */
+    constexpr void reset(size_t depth = 0)
+    {
+        this->depth = depth;
+    }
+
+    constexpr void open(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        write_indent();
+        append_start_tag(out, tag, attributes, options);
+        end_line();
+        depth++;
+        if(has_flag(tag.id, TagFlags::RawText))
+            next_raw_text = raw_text_kind(tag, attributes, options);
+    }
+
+    constexpr void void_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        write_indent();
+        append_start_tag(out, tag, attributes, options);
+        end_line();
+    }
+
+    constexpr void text(const std::string_view text)
+    {
+        write_indent();
+        append_text(out, placeholder_text_kind(html_text_kind(options), text, options), text);
+        end_line();
+    }
+
+    constexpr void raw_text(const std::string_view text)
+    {
+        // Raw text comes right after the start tag of its element
+        write_indent();
+        append_text(out, placeholder_text_kind(next_raw_text, text, options), text);
+        end_line();
+    }
+
+    constexpr void close(const Tag tag)
+    {
+        depth--;
+        write_indent();
+        append_end_tag(out, tag);
+        end_line();
+    }
+
+private:
+    constexpr void write_indent()
+    {
+        if(indent != 0)
+            out.append(indent * depth, ' ');
+    }
+
+    constexpr void end_line()
+    {
+        if(newline)
+            out.append(1, '\n');
+    }
+
+    Sink& out;
+    Options options;
+    size_t indent;
+    bool newline;
+    size_t depth;
+    // How to write the text of the last raw text element opened
+    TextKind next_raw_text = TextKind::Plain;
+};
+
+}
@@ -0,0 +1,945 @@
+#pragma once
+
+// Generated by tools/generate_entities.py from Python's html.entities.html5, do not edit
+
+#include <cstdint>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+struct NamedEntity
+{
+    uint16_t name_offset;
+    uint8_t name_length;
+    // Index in entity_second_codepoints, 0 if the reference is a single character
+    uint8_t second;
+    uint32_t codepoint;
+};
+
+struct EntityShortestName
+{
+    uint32_t codepoint;
+    uint16_t entity;
+};
+
+// Names of the references without the semicolon, concatenated in sorted order
+inline constexpr std::string_view entity_names =
+    "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAscrAssignAtildeAumlBackslashBarv"
+    "BarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCapCapitalDifferentialDCayleysCcaronCcedil"
+    "CcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinusCirclePlusCircleTimesClockwiseContourIntegral"
+    "CloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintContourIntegralCopfCoproduct"
+    "CounterClockwiseContourIntegralCrossCscrCupCupCapDDDDotrahdDJcyDScyDZcyDaggerDarrDashvDcaronDcyDelDeltaDfr"
+    "DiacriticalAcuteDiacriticalDotDiacriticalDoubleAcuteDiacriticalGraveDiacriticalTildeDiamondDifferentialDDopf"
+    "DotDotDotDotEqualDoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTee"
+    "DoubleLongLeftArrowDoubleLongLeftRightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTeeDoubleUpArrow"
+    "DoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreveDownLeftRightVector"
+    "DownLeftTeeVectorDownLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDownRightVectorBarDownTee"
+    "DownTeeArrowDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgraveElementEmacrEmptySmallSquare"
+    "EmptyVerySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsimEtaEumlExistsExponentialEFcyFfr"
+    "FilledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcyGdotGfrGg"
+    "GopfGreaterEqualGreaterEqualLessGreaterFullEqualGreaterGreaterGreaterLessGreaterSlantEqualGreaterTildeGscrGt"
+    "HARDcyHacekHatHcircHfrHilbertSpaceHopfHorizontalLineHscrHstrokHumpDownHumpHumpEqualIEcyIJligIOcyIacuteIcircIcy"
+    "IdotIfrIgraveImImacrImaginaryIImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogonIopfIotaIscr"
+    "ItildeIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJcyKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrf"
+    "LarrLcaronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRightArrowLeftCeilingLeftDoubleBracket"
+    "LeftDownTeeVectorLeftDownVectorLeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLeftTeeArrow"
+    "LeftTeeVectorLeftTriangleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVectorLeftUpVector"
+    "LeftUpVectorBarLeftVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreaterLessFullEqualLessGreaterLessLess"
+    "LessSlantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarrow"
+    "LongleftrightarrowLongrightarrowLopfLowerLeftArrowLowerRightArrowLscrLshLstrokLtMapMcyMediumSpaceMellintrfMfr"
+    "MinusPlusMopfMscrMuNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNegativeThickSpaceNegativeThinSpace"
+    "NegativeVeryThinSpaceNestedGreaterGreaterNestedLessLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruent"
+    "NotCupCapNotDoubleVerticalBarNotElementNotEqualNotEqualTildeNotExistsNotGreaterNotGreaterEqual"
+    "NotGreaterFullEqualNotGreaterGreaterNotGreaterLessNotGreaterSlantEqualNotGreaterTildeNotHumpDownHump"
+    "NotHumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNotLessNotLessEqualNotLessGreaterNotLessLess"
+    "NotLessSlantEqualNotLessTildeNotNestedGreaterGreaterNotNestedLessLessNotPrecedesNotPrecedesEqual"
+    "NotPrecedesSlantEqualNotReverseElementNotRightTriangleNotRightTriangleBarNotRightTriangleEqualNotSquareSubset"
+    "NotSquareSubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSubsetEqualNotSucceedsNotSucceedsEqual"
+    "NotSucceedsSlantEqualNotSucceedsTildeNotSupersetNotSupersetEqualNotTildeNotTildeEqualNotTildeFullEqual"
+    "NotTildeTildeNotVerticalBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfrOgraveOmacrOmegaOmicronOopf"
+    "OpenCurlyDoubleQuoteOpenCurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracketOverParenthesis"
+    "PartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrPrecedesPrecedesEqualPrecedesSlantEqualPrecedesTildePrime"
+    "ProductProportionProportionalPscrPsiQUOTQfrQopfQscrRBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseElement"
+    "ReverseEquilibriumReverseUpEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightArrowLeftArrow"
+    "RightCeilingRightDoubleBracketRightDownTeeVectorRightDownVectorRightDownVectorBarRightFloorRightTee"
+    "RightTeeArrowRightTeeVectorRightTriangleRightTriangleBarRightTriangleEqualRightUpDownVectorRightUpTeeVector"
+    "RightUpVectorRightUpVectorBarRightVectorRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRuleDelayed"
+    "SHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDownArrowShortLeftArrowShortRightArrowShortUpArrowSigma"
+    "SmallCircleSopfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqualSquareSupersetSquareSupersetEqual"
+    "SquareUnionSscrStarSubSubsetSubsetEqualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatSumSup"
+    "SupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTauTcaronTcedilTcyTfrThereforeThetaThickSpaceThinSpaceTilde"
+    "TildeEqualTildeFullEqualTildeTildeTopfTripleDotTscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgrave"
+    "UmacrUnderBarUnderBraceUnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrowDownArrow"
+    "UpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscr"
+    "UtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVerticalSeparatorVerticalTilde"
+    "VeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopfYscrYumlZHcy"
+    "ZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabreveacacEacdacircacuteacyaeligafafragravealefsymaleph"
+    "alphaamacramalgampandandandanddandslopeandvangangeangleangmsdangmsdaaangmsdabangmsdacangmsdadangmsdaeangmsdaf"
+    "angmsdagangmsdahangrtangrtvbangrtvbdangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeqaringascr"
+    "astasympasympeqatildeaumlawconintawintbNotbackcongbackepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrk"
+    "bbrktbrkbcongbcybdquobecausbecausebemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplus"
+    "bigotimesbigsqcupbigstarbigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblacksquare"
+    "blacktriangleblacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34blockbnebnequivbnotbopf"
+    "botbottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxUrboxVboxVHboxVLboxVRboxVhboxVl"
+    "boxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxulboxurboxvboxvH"
+    "boxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsimbsimebsolbsolbbsolhsubbullbulletbumpbumpEbumpebumpeq"
+    "cacutecapcapandcapbrcupcapcapcapcupcapdotcapscaretcaronccapsccaronccedilccircccupsccupssmcdotcedilcemptyvcent"
+    "centerdotcfrchcycheckcheckmarkchicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircledScircledast"
+    "circledcirccircleddashcirecirfnintcirmidcirscirclubsclubsuitcoloncolonecoloneqcommacommatcompcompfncomplement"
+    "complexescongcongdotconintcopfcoprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprcuesc"
+    "cularrcularrpcupcupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyveecurlywedgecurren"
+    "curvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarowdblacdcaron"
+    "dcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdiamonddiamondsuitdiamsdiedigammadisindivdivide"
+    "divideontimesdivonxdjcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplusdotsquaredoublebarwedgedownarrow"
+    "downdownarrowsdownharpoonleftdownharpoonrightdrbkarowdrcorndrcropdscrdscydsoldstrokdtdotdtridtrifduarrduhar"
+    "dwangledzcydzigrarreDDoteDoteacuteeasterecaronecirecircecolonecyedoteeefDotefregegraveegsegsdotelelintersell"
+    "elselsdotemacremptyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcolon"
+    "eqsimeqslantgtreqslantlessequalsequestequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexclexist"
+    "expectationexponentialefallingdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfnoffopfforallfork"
+    "forkvfpartintfrac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38frac45frac56frac58frac78frasl"
+    "frownfscrgEgElgacutegammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotolgesl"
+    "geslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneqqgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdot"
+    "gtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnEhArrhairsphalfhamilthardcyharr"
+    "harrcirharrwhbarhcircheartsheartsuithellipherconhfrhksearowhkswarowhoarrhomththookleftarrowhookrightarrowhopf"
+    "horbarhscrhslashhstrokhybullhypheniacuteicicircicyiecyiexcliffifrigraveiiiiiintiiintiinfiniiotaijligimacrimage"
+    "imaglineimagpartimathimofimpedinincareinfininfintieinodotintintcalintegersintercalintlarhkintprodiocyiogoniopf"
+    "iotaiprodiquestiscrisinisinEisindotisinsisinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfjscrjsercyjukcykappa"
+    "kappavkcedilkcykfrkgreenkhcykjcykopfkscrlAarrlArrlAtaillBarrlElEglHarlacutelaemptyvlagranlambdalanglangdlangle"
+    "laplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtllatlataillatelateslbarrlbbrklbracelbracklbrke"
+    "lbrksldlbrkslulcaronlcedillceillcublcyldcaldquoldquorldrdharldrusharldshleleftarrowleftarrowtail"
+    "leftharpoondownleftharpoonupleftleftarrowsleftrightarrowleftrightarrowsleftrightharpoonsleftrightsquigarrow"
+    "leftthreetimeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgeslessapproxlessdotlesseqgtrlesseqqgtr"
+    "lessgtrlesssimlfishtlfloorlfrlglgElhardlharulharullhblkljcyllllarrllcornerllhardlltrilmidotlmoustlmoustachelnE"
+    "lnaplnapproxlnelneqlneqqlnsimloangloarrlobrklongleftarrowlongleftrightarrowlongmapstolongrightarrow"
+    "looparrowleftlooparrowrightloparlopflopluslotimeslowastlowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhard"
+    "lrmlrtrilsaquolscrlshlsimlsimelsimglsqblsquolsquorlstrokltltccltcirltdotlthreeltimesltlarrltquestltrParltri"
+    "ltrieltriflurdsharluruharlvertneqqlvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapstoleftmapstoupmarker"
+    "mcommamcymdashmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbminusdminusdumlcpmldrmnplusmodelsmopfmp"
+    "mscrmstposmumultimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnablanacutenang"
+    "napnapEnapidnaposnapproxnaturnaturalnaturalsnbspnbumpnbumpencapncaronncedilncongncongdotncupncyndashneneArr"
+    "nearhknearrnearrownedotnequivnesearnesimnexistnexistsnfrngEngengeqngeqqngeqslantngesngsimngtngtrnhArrnharr"
+    "nhparninisnisdnivnjcynlArrnlEnlarrnldrnlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnlsimnltnltri"
+    "nltrienmidnopfnotnotinnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivbnotnivcnparnparallelnparslnpart"
+    "npolintnprnprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrownrtrinrtrienscnsccuenscenscrnshortmid"
+    "nshortparallelnsimnsimensimeqnsmidnsparnsqsubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccnsucceqnsup"
+    "nsupEnsupensupsetnsupseteqnsupseteqqntglntildentlgntriangleleftntrianglelefteqntrianglerightntrianglerighteqnu"
+    "numnumeronumspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvltnvltrienvrArrnvrtrienvsimnwArrnwarhknwarr"
+    "nwarrownwnearoSoacuteoastocirocircocyodashodblacodivodotodsoldoeligofcirofrogonograveogtohbarohmointolarrolcir"
+    "olcrossolineoltomacromegaomicronomidominusoopfoparoperpoplusororarrordorderorderofordfordmorigoforororslopeorv"
+    "oscroslashosolotildeotimesotimesasoumlovbarparparaparallelparsimparslpartpcypercntperiodpermilperppertenkpfr"
+    "phiphivphmmatphonepipitchforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmnplussim"
+    "plustwopmpointintpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapproxprecneqqprecnsimprecsim"
+    "primeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsipuncspqfrqintqopfqprimeqscr"
+    "quaternionsquatintquestquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrangrangdrangerangleraquorarr"
+    "rarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtlrarrwratailratiorationalsrbarrrbbrkrbracerbrack"
+    "rbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardldharrdquordquorrdshrealrealinerealpartrealsrectregrfisht"
+    "rfloorrfrrhardrharurharulrhorhovrightarrowrightarrowtailrightharpoondownrightharpoonuprightleftarrows"
+    "rightleftharpoonsrightrightarrowsrightsquigarrowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustache"
+    "rnmidroangroarrrobrkroparropfroplusrotimesrparrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimesrtri"
+    "rtriertrifrtriltriruluharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpolintscsimscysdot"
+    "sdotbsdoteseArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrownsharpshchcyshcyshortmidshortparallel"
+    "shysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimnesimplussimrarrslarrsmallsetminussmashpsmeparsl"
+    "smidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsqcupssqsubsqsubesqsubset"
+    "sqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarrsscrssetmnssmilesstarfstarstarfstraightepsilon"
+    "straightphistrnssubsubEsubdotsubesubedotsubmultsubnEsubnesubplussubrarrsubsetsubseteqsubseteqqsubsetneq"
+    "subsetneqqsubsimsubsubsubsupsuccsuccapproxsucccurlyeqsucceqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1"
+    "sup2sup3supEsupdotsupdsubsupesupedotsuphsolsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqq"
+    "supsetneqsupsetneqqsupsimsupsubsupsupswArrswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrec"
+    "tfrthere4thereforethetathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesbtimesbartimesd"
+    "tinttoeatoptopbottopcirtopftopforktosatprimetradetriangletriangledowntrianglelefttrianglelefteqtriangleq"
+    "trianglerighttrianglerighteqtridottrietriminustriplustrisbtritimetrpeziumtscrtscytshcytstroktwixt"
+    "twoheadleftarrowtwoheadrightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufrugraveuharl"
+    "uharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrowupharpoonleftupharpoonrightuplusupsi"
+    "upsihupsilonupuparrowsurcornurcornerurcropuringurtriuscrutdotutildeutriutrifuuarruumluwanglevArrvBarvBarvvDash"
+    "vangrtvarepsilonvarkappavarnothingvarphivarpivarproptovarrvarrhovarsigmavarsubsetneqvarsubsetneqqvarsupsetneq"
+    "varsupsetneqqvarthetavartriangleleftvartrianglerightvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsup"
+    "vopfvpropvrtrivscrvsubnEvsubnevsupnEvsupnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreathwscrxcapxcirc"
+    "xcupxdtrixfrxhArrxharrxixlArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixveexwedgeyacute"
+    "yacyycircycyyenyfryicyyopfyscryucyyumlzacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj"
+    ;
+
+inline constexpr uint32_t entity_second_codepoints[] = {0, 0x6A, 0x331, 0x333, 0x338, 0x200A, 0x20D2, 0x20E5, 0xFE00};
+
+// Sorted by name
+inline constexpr NamedEntity named_entities[] = {
+    {0, 5, 0, 0xC6}, {5, 3, 0, 0x26}, {8, 6, 0, 0xC1}, {14, 6, 0, 0x102},
+    {20, 5, 0, 0xC2}, {25, 3, 0, 0x410}, {28, 3, 0, 0x1D504}, {31, 6, 0, 0xC0},
+    {37, 5, 0, 0x391}, {42, 5, 0, 0x100}, {47, 3, 0, 0x2A53}, {50, 5, 0, 0x104},
+    {55, 4, 0, 0x1D538}, {59, 13, 0, 0x2061}, {72, 5, 0, 0xC5}, {77, 4, 0, 0x1D49C},
+    {81, 6, 0, 0x2254}, {87, 6, 0, 0xC3}, {93, 4, 0, 0xC4}, {97, 9, 0, 0x2216},
+    {106, 4, 0, 0x2AE7}, {110, 6, 0, 0x2306}, {116, 3, 0, 0x411}, {119, 7, 0, 0x2235},
+    {126, 10, 0, 0x212C}, {136, 4, 0, 0x392}, {140, 3, 0, 0x1D505}, {143, 4, 0, 0x1D539},
+    {147, 5, 0, 0x2D8}, {152, 4, 0, 0x212C}, {156, 6, 0, 0x224E}, {162, 4, 0, 0x427},
+    {166, 4, 0, 0xA9}, {170, 6, 0, 0x106}, {176, 3, 0, 0x22D2}, {179, 20, 0, 0x2145},
+    {199, 7, 0, 0x212D}, {206, 6, 0, 0x10C}, {212, 6, 0, 0xC7}, {218, 5, 0, 0x108},
+    {223, 7, 0, 0x2230}, {230, 4, 0, 0x10A}, {234, 7, 0, 0xB8}, {241, 9, 0, 0xB7},
+    {250, 3, 0, 0x212D}, {253, 3, 0, 0x3A7}, {256, 9, 0, 0x2299}, {265, 11, 0, 0x2296},
+    {276, 10, 0, 0x2295}, {286, 11, 0, 0x2297}, {297, 24, 0, 0x2232}, {321, 21, 0, 0x201D},
+    {342, 15, 0, 0x2019}, {357, 5, 0, 0x2237}, {362, 6, 0, 0x2A74}, {368, 9, 0, 0x2261},
+    {377, 6, 0, 0x222F}, {383, 15, 0, 0x222E}, {398, 4, 0, 0x2102}, {402, 9, 0, 0x2210},
+    {411, 31, 0, 0x2233}, {442, 5, 0, 0x2A2F}, {447, 4, 0, 0x1D49E}, {451, 3, 0, 0x22D3},
+    {454, 6, 0, 0x224D}, {460, 2, 0, 0x2145}, {462, 8, 0, 0x2911}, {470, 4, 0, 0x402},
+    {474, 4, 0, 0x405}, {478, 4, 0, 0x40F}, {482, 6, 0, 0x2021}, {488, 4, 0, 0x21A1},
+    {492, 5, 0, 0x2AE4}, {497, 6, 0, 0x10E}, {503, 3, 0, 0x414}, {506, 3, 0, 0x2207},
+    {509, 5, 0, 0x394}, {514, 3, 0, 0x1D507}, {517, 16, 0, 0xB4}, {533, 14, 0, 0x2D9},
+    {547, 22, 0, 0x2DD}, {569, 16, 0, 0x60}, {585, 16, 0, 0x2DC}, {601, 7, 0, 0x22C4},
+    {608, 13, 0, 0x2146}, {621, 4, 0, 0x1D53B}, {625, 3, 0, 0xA8}, {628, 6, 0, 0x20DC},
+    {634, 8, 0, 0x2250}, {642, 21, 0, 0x222F}, {663, 9, 0, 0xA8}, {672, 15, 0, 0x21D3},
+    {687, 15, 0, 0x21D0}, {702, 20, 0, 0x21D4}, {722, 13, 0, 0x2AE4}, {735, 19, 0, 0x27F8},
+    {754, 24, 0, 0x27FA}, {778, 20, 0, 0x27F9}, {798, 16, 0, 0x21D2}, {814, 14, 0, 0x22A8},
+    {828, 13, 0, 0x21D1}, {841, 17, 0, 0x21D5}, {858, 17, 0, 0x2225}, {875, 9, 0, 0x2193},
+    {884, 12, 0, 0x2913}, {896, 16, 0, 0x21F5}, {912, 9, 0, 0x311}, {921, 19, 0, 0x2950},
+    {940, 17, 0, 0x295E}, {957, 14, 0, 0x21BD}, {971, 17, 0, 0x2956}, {988, 18, 0, 0x295F},
+    {1006, 15, 0, 0x21C1}, {1021, 18, 0, 0x2957}, {1039, 7, 0, 0x22A4}, {1046, 12, 0, 0x21A7},
+    {1058, 9, 0, 0x21D3}, {1067, 4, 0, 0x1D49F}, {1071, 6, 0, 0x110}, {1077, 3, 0, 0x14A},
+    {1080, 3, 0, 0xD0}, {1083, 6, 0, 0xC9}, {1089, 6, 0, 0x11A}, {1095, 5, 0, 0xCA},
+    {1100, 3, 0, 0x42D}, {1103, 4, 0, 0x116}, {1107, 3, 0, 0x1D508}, {1110, 6, 0, 0xC8},
+    {1116, 7, 0, 0x2208}, {1123, 5, 0, 0x112}, {1128, 16, 0, 0x25FB}, {1144, 20, 0, 0x25AB},
+    {1164, 5, 0, 0x118}, {1169, 4, 0, 0x1D53C}, {1173, 7, 0, 0x395}, {1180, 5, 0, 0x2A75},
+    {1185, 10, 0, 0x2242}, {1195, 11, 0, 0x21CC}, {1206, 4, 0, 0x2130}, {1210, 4, 0, 0x2A73},
+    {1214, 3, 0, 0x397}, {1217, 4, 0, 0xCB}, {1221, 6, 0, 0x2203}, {1227, 12, 0, 0x2147},
+    {1239, 3, 0, 0x424}, {1242, 3, 0, 0x1D509}, {1245, 17, 0, 0x25FC}, {1262, 21, 0, 0x25AA},
+    {1283, 4, 0, 0x1D53D}, {1287, 6, 0, 0x2200}, {1293, 10, 0, 0x2131}, {1303, 4, 0, 0x2131},
+    {1307, 4, 0, 0x403}, {1311, 2, 0, 0x3E}, {1313, 5, 0, 0x393}, {1318, 6, 0, 0x3DC},
+    {1324, 6, 0, 0x11E}, {1330, 6, 0, 0x122}, {1336, 5, 0, 0x11C}, {1341, 3, 0, 0x413},
+    {1344, 4, 0, 0x120}, {1348, 3, 0, 0x1D50A}, {1351, 2, 0, 0x22D9}, {1353, 4, 0, 0x1D53E},
+    {1357, 12, 0, 0x2265}, {1369, 16, 0, 0x22DB}, {1385, 16, 0, 0x2267}, {1401, 14, 0, 0x2AA2},
+    {1415, 11, 0, 0x2277}, {1426, 17, 0, 0x2A7E}, {1443, 12, 0, 0x2273}, {1455, 4, 0, 0x1D4A2},
+    {1459, 2, 0, 0x226B}, {1461, 6, 0, 0x42A}, {1467, 5, 0, 0x2C7}, {1472, 3, 0, 0x5E},
+    {1475, 5, 0, 0x124}, {1480, 3, 0, 0x210C}, {1483, 12, 0, 0x210B}, {1495, 4, 0, 0x210D},
+    {1499, 14, 0, 0x2500}, {1513, 4, 0, 0x210B}, {1517, 6, 0, 0x126}, {1523, 12, 0, 0x224E},
+    {1535, 9, 0, 0x224F}, {1544, 4, 0, 0x415}, {1548, 5, 0, 0x132}, {1553, 4, 0, 0x401},
+    {1557, 6, 0, 0xCD}, {1563, 5, 0, 0xCE}, {1568, 3, 0, 0x418}, {1571, 4, 0, 0x130},
+    {1575, 3, 0, 0x2111}, {1578, 6, 0, 0xCC}, {1584, 2, 0, 0x2111}, {1586, 5, 0, 0x12A},
+    {1591, 10, 0, 0x2148}, {1601, 7, 0, 0x21D2}, {1608, 3, 0, 0x222C}, {1611, 8, 0, 0x222B},
+    {1619, 12, 0, 0x22C2}, {1631, 14, 0, 0x2063}, {1645, 14, 0, 0x2062}, {1659, 5, 0, 0x12E},
+    {1664, 4, 0, 0x1D540}, {1668, 4, 0, 0x399}, {1672, 4, 0, 0x2110}, {1676, 6, 0, 0x128},
+    {1682, 5, 0, 0x406}, {1687, 4, 0, 0xCF}, {1691, 5, 0, 0x134}, {1696, 3, 0, 0x419},
+    {1699, 3, 0, 0x1D50D}, {1702, 4, 0, 0x1D541}, {1706, 4, 0, 0x1D4A5}, {1710, 6, 0, 0x408},
+    {1716, 5, 0, 0x404}, {1721, 4, 0, 0x425}, {1725, 4, 0, 0x40C}, {1729, 5, 0, 0x39A},
+    {1734, 6, 0, 0x136}, {1740, 3, 0, 0x41A}, {1743, 3, 0, 0x1D50E}, {1746, 4, 0, 0x1D542},
+    {1750, 4, 0, 0x1D4A6}, {1754, 4, 0, 0x409}, {1758, 2, 0, 0x3C}, {1760, 6, 0, 0x139},
+    {1766, 6, 0, 0x39B}, {1772, 4, 0, 0x27EA}, {1776, 10, 0, 0x2112}, {1786, 4, 0, 0x219E},
+    {1790, 6, 0, 0x13D}, {1796, 6, 0, 0x13B}, {1802, 3, 0, 0x41B}, {1805, 16, 0, 0x27E8},
+    {1821, 9, 0, 0x2190}, {1830, 12, 0, 0x21E4}, {1842, 19, 0, 0x21C6}, {1861, 11, 0, 0x2308},
+    {1872, 17, 0, 0x27E6}, {1889, 17, 0, 0x2961}, {1906, 14, 0, 0x21C3}, {1920, 17, 0, 0x2959},
+    {1937, 9, 0, 0x230A}, {1946, 14, 0, 0x2194}, {1960, 15, 0, 0x294E}, {1975, 7, 0, 0x22A3},
+    {1982, 12, 0, 0x21A4}, {1994, 13, 0, 0x295A}, {2007, 12, 0, 0x22B2}, {2019, 15, 0, 0x29CF},
+    {2034, 17, 0, 0x22B4}, {2051, 16, 0, 0x2951}, {2067, 15, 0, 0x2960}, {2082, 12, 0, 0x21BF},
+    {2094, 15, 0, 0x2958}, {2109, 10, 0, 0x21BC}, {2119, 13, 0, 0x2952}, {2132, 9, 0, 0x21D0},
+    {2141, 14, 0, 0x21D4}, {2155, 16, 0, 0x22DA}, {2171, 13, 0, 0x2266}, {2184, 11, 0, 0x2276},
+    {2195, 8, 0, 0x2AA1}, {2203, 14, 0, 0x2A7D}, {2217, 9, 0, 0x2272}, {2226, 3, 0, 0x1D50F},
+    {2229, 2, 0, 0x22D8}, {2231, 10, 0, 0x21DA}, {2241, 6, 0, 0x13F}, {2247, 13, 0, 0x27F5},
+    {2260, 18, 0, 0x27F7}, {2278, 14, 0, 0x27F6}, {2292, 13, 0, 0x27F8}, {2305, 18, 0, 0x27FA},
+    {2323, 14, 0, 0x27F9}, {2337, 4, 0, 0x1D543}, {2341, 14, 0, 0x2199}, {2355, 15, 0, 0x2198},
+    {2370, 4, 0, 0x2112}, {2374, 3, 0, 0x21B0}, {2377, 6, 0, 0x141}, {2383, 2, 0, 0x226A},
+    {2385, 3, 0, 0x2905}, {2388, 3, 0, 0x41C}, {2391, 11, 0, 0x205F}, {2402, 9, 0, 0x2133},
+    {2411, 3, 0, 0x1D510}, {2414, 9, 0, 0x2213}, {2423, 4, 0, 0x1D544}, {2427, 4, 0, 0x2133},
+    {2431, 2, 0, 0x39C}, {2433, 4, 0, 0x40A}, {2437, 6, 0, 0x143}, {2443, 6, 0, 0x147},
+    {2449, 6, 0, 0x145}, {2455, 3, 0, 0x41D}, {2458, 19, 0, 0x200B}, {2477, 18, 0, 0x200B},
+    {2495, 17, 0, 0x200B}, {2512, 21, 0, 0x200B}, {2533, 20, 0, 0x226B}, {2553, 14, 0, 0x226A},
+    {2567, 7, 0, 0xA}, {2574, 3, 0, 0x1D511}, {2577, 7, 0, 0x2060}, {2584, 16, 0, 0xA0},
+    {2600, 4, 0, 0x2115}, {2604, 3, 0, 0x2AEC}, {2607, 12, 0, 0x2262}, {2619, 9, 0, 0x226D},
+    {2628, 20, 0, 0x2226}, {2648, 10, 0, 0x2209}, {2658, 8, 0, 0x2260}, {2666, 13, 4, 0x2242},
+    {2679, 9, 0, 0x2204}, {2688, 10, 0, 0x226F}, {2698, 15, 0, 0x2271}, {2713, 19, 4, 0x2267},
+    {2732, 17, 4, 0x226B}, {2749, 14, 0, 0x2279}, {2763, 20, 4, 0x2A7E}, {2783, 15, 0, 0x2275},
+    {2798, 15, 4, 0x224E}, {2813, 12, 4, 0x224F}, {2825, 15, 0, 0x22EA}, {2840, 18, 4, 0x29CF},
+    {2858, 20, 0, 0x22EC}, {2878, 7, 0, 0x226E}, {2885, 12, 0, 0x2270}, {2897, 14, 0, 0x2278},
+    {2911, 11, 4, 0x226A}, {2922, 17, 4, 0x2A7D}, {2939, 12, 0, 0x2274}, {2951, 23, 4, 0x2AA2},
+    {2974, 17, 4, 0x2AA1}, {2991, 11, 0, 0x2280}, {3002, 16, 4, 0x2AAF}, {3018, 21, 0, 0x22E0},
+    {3039, 17, 0, 0x220C}, {3056, 16, 0, 0x22EB}, {3072, 19, 4, 0x29D0}, {3091, 21, 0, 0x22ED},
+    {3112, 15, 4, 0x228F}, {3127, 20, 0, 0x22E2}, {3147, 17, 4, 0x2290}, {3164, 22, 0, 0x22E3},
+    {3186, 9, 6, 0x2282}, {3195, 14, 0, 0x2288}, {3209, 11, 0, 0x2281}, {3220, 16, 4, 0x2AB0},
+    {3236, 21, 0, 0x22E1}, {3257, 16, 4, 0x227F}, {3273, 11, 6, 0x2283}, {3284, 16, 0, 0x2289},
+    {3300, 8, 0, 0x2241}, {3308, 13, 0, 0x2244}, {3321, 17, 0, 0x2247}, {3338, 13, 0, 0x2249},
+    {3351, 14, 0, 0x2224}, {3365, 4, 0, 0x1D4A9}, {3369, 6, 0, 0xD1}, {3375, 2, 0, 0x39D},
+    {3377, 5, 0, 0x152}, {3382, 6, 0, 0xD3}, {3388, 5, 0, 0xD4}, {3393, 3, 0, 0x41E},
+    {3396, 6, 0, 0x150}, {3402, 3, 0, 0x1D512}, {3405, 6, 0, 0xD2}, {3411, 5, 0, 0x14C},
+    {3416, 5, 0, 0x3A9}, {3421, 7, 0, 0x39F}, {3428, 4, 0, 0x1D546}, {3432, 20, 0, 0x201C},
+    {3452, 14, 0, 0x2018}, {3466, 2, 0, 0x2A54}, {3468, 4, 0, 0x1D4AA}, {3472, 6, 0, 0xD8},
+    {3478, 6, 0, 0xD5}, {3484, 6, 0, 0x2A37}, {3490, 4, 0, 0xD6}, {3494, 7, 0, 0x203E},
+    {3501, 9, 0, 0x23DE}, {3510, 11, 0, 0x23B4}, {3521, 15, 0, 0x23DC}, {3536, 8, 0, 0x2202},
+    {3544, 3, 0, 0x41F}, {3547, 3, 0, 0x1D513}, {3550, 3, 0, 0x3A6}, {3553, 2, 0, 0x3A0},
+    {3555, 9, 0, 0xB1}, {3564, 13, 0, 0x210C}, {3577, 4, 0, 0x2119}, {3581, 2, 0, 0x2ABB},
+    {3583, 8, 0, 0x227A}, {3591, 13, 0, 0x2AAF}, {3604, 18, 0, 0x227C}, {3622, 13, 0, 0x227E},
+    {3635, 5, 0, 0x2033}, {3640, 7, 0, 0x220F}, {3647, 10, 0, 0x2237}, {3657, 12, 0, 0x221D},
+    {3669, 4, 0, 0x1D4AB}, {3673, 3, 0, 0x3A8}, {3676, 4, 0, 0x22}, {3680, 3, 0, 0x1D514},
+    {3683, 4, 0, 0x211A}, {3687, 4, 0, 0x1D4AC}, {3691, 5, 0, 0x2910}, {3696, 3, 0, 0xAE},
+    {3699, 6, 0, 0x154}, {3705, 4, 0, 0x27EB}, {3709, 4, 0, 0x21A0}, {3713, 6, 0, 0x2916},
+    {3719, 6, 0, 0x158}, {3725, 6, 0, 0x156}, {3731, 3, 0, 0x420}, {3734, 2, 0, 0x211C},
+    {3736, 14, 0, 0x220B}, {3750, 18, 0, 0x21CB}, {3768, 20, 0, 0x296F}, {3788, 3, 0, 0x211C},
+    {3791, 3, 0, 0x3A1}, {3794, 17, 0, 0x27E9}, {3811, 10, 0, 0x2192}, {3821, 13, 0, 0x21E5},
+    {3834, 19, 0, 0x21C4}, {3853, 12, 0, 0x2309}, {3865, 18, 0, 0x27E7}, {3883, 18, 0, 0x295D},
+    {3901, 15, 0, 0x21C2}, {3916, 18, 0, 0x2955}, {3934, 10, 0, 0x230B}, {3944, 8, 0, 0x22A2},
+    {3952, 13, 0, 0x21A6}, {3965, 14, 0, 0x295B}, {3979, 13, 0, 0x22B3}, {3992, 16, 0, 0x29D0},
+    {4008, 18, 0, 0x22B5}, {4026, 17, 0, 0x294F}, {4043, 16, 0, 0x295C}, {4059, 13, 0, 0x21BE},
+    {4072, 16, 0, 0x2954}, {4088, 11, 0, 0x21C0}, {4099, 14, 0, 0x2953}, {4113, 10, 0, 0x21D2},
+    {4123, 4, 0, 0x211D}, {4127, 12, 0, 0x2970}, {4139, 11, 0, 0x21DB}, {4150, 4, 0, 0x211B},
+    {4154, 3, 0, 0x21B1}, {4157, 11, 0, 0x29F4}, {4168, 6, 0, 0x429}, {4174, 4, 0, 0x428},
+    {4178, 6, 0, 0x42C}, {4184, 6, 0, 0x15A}, {4190, 2, 0, 0x2ABC}, {4192, 6, 0, 0x160},
+    {4198, 6, 0, 0x15E}, {4204, 5, 0, 0x15C}, {4209, 3, 0, 0x421}, {4212, 3, 0, 0x1D516},
+    {4215, 14, 0, 0x2193}, {4229, 14, 0, 0x2190}, {4243, 15, 0, 0x2192}, {4258, 12, 0, 0x2191},
+    {4270, 5, 0, 0x3A3}, {4275, 11, 0, 0x2218}, {4286, 4, 0, 0x1D54A}, {4290, 4, 0, 0x221A},
+    {4294, 6, 0, 0x25A1}, {4300, 18, 0, 0x2293}, {4318, 12, 0, 0x228F}, {4330, 17, 0, 0x2291},
+    {4347, 14, 0, 0x2290}, {4361, 19, 0, 0x2292}, {4380, 11, 0, 0x2294}, {4391, 4, 0, 0x1D4AE},
+    {4395, 4, 0, 0x22C6}, {4399, 3, 0, 0x22D0}, {4402, 6, 0, 0x22D0}, {4408, 11, 0, 0x2286},
+    {4419, 8, 0, 0x227B}, {4427, 13, 0, 0x2AB0}, {4440, 18, 0, 0x227D}, {4458, 13, 0, 0x227F},
+    {4471, 8, 0, 0x220B}, {4479, 3, 0, 0x2211}, {4482, 3, 0, 0x22D1}, {4485, 8, 0, 0x2283},
+    {4493, 13, 0, 0x2287}, {4506, 6, 0, 0x22D1}, {4512, 5, 0, 0xDE}, {4517, 5, 0, 0x2122},
+    {4522, 5, 0, 0x40B}, {4527, 4, 0, 0x426}, {4531, 3, 0, 0x9}, {4534, 3, 0, 0x3A4},
+    {4537, 6, 0, 0x164}, {4543, 6, 0, 0x162}, {4549, 3, 0, 0x422}, {4552, 3, 0, 0x1D517},
+    {4555, 9, 0, 0x2234}, {4564, 5, 0, 0x398}, {4569, 10, 5, 0x205F}, {4579, 9, 0, 0x2009},
+    {4588, 5, 0, 0x223C}, {4593, 10, 0, 0x2243}, {4603, 14, 0, 0x2245}, {4617, 10, 0, 0x2248},
+    {4627, 4, 0, 0x1D54B}, {4631, 9, 0, 0x20DB}, {4640, 4, 0, 0x1D4AF}, {4644, 6, 0, 0x166},
+    {4650, 6, 0, 0xDA}, {4656, 4, 0, 0x219F}, {4660, 8, 0, 0x2949}, {4668, 5, 0, 0x40E},
+    {4673, 6, 0, 0x16C}, {4679, 5, 0, 0xDB}, {4684, 3, 0, 0x423}, {4687, 6, 0, 0x170},
+    {4693, 3, 0, 0x1D518}, {4696, 6, 0, 0xD9}, {4702, 5, 0, 0x16A}, {4707, 8, 0, 0x5F},
+    {4715, 10, 0, 0x23DF}, {4725, 12, 0, 0x23B5}, {4737, 16, 0, 0x23DD}, {4753, 5, 0, 0x22C3},
+    {4758, 9, 0, 0x228E}, {4767, 5, 0, 0x172}, {4772, 4, 0, 0x1D54C}, {4776, 7, 0, 0x2191},
+    {4783, 10, 0, 0x2912}, {4793, 16, 0, 0x21C5}, {4809, 11, 0, 0x2195}, {4820, 13, 0, 0x296E},
+    {4833, 5, 0, 0x22A5}, {4838, 10, 0, 0x21A5}, {4848, 7, 0, 0x21D1}, {4855, 11, 0, 0x21D5},
+    {4866, 14, 0, 0x2196}, {4880, 15, 0, 0x2197}, {4895, 4, 0, 0x3D2}, {4899, 7, 0, 0x3A5},
+    {4906, 5, 0, 0x16E}, {4911, 4, 0, 0x1D4B0}, {4915, 6, 0, 0x168}, {4921, 4, 0, 0xDC},
+    {4925, 5, 0, 0x22AB}, {4930, 4, 0, 0x2AEB}, {4934, 3, 0, 0x412}, {4937, 5, 0, 0x22A9},
+    {4942, 6, 0, 0x2AE6}, {4948, 3, 0, 0x22C1}, {4951, 6, 0, 0x2016}, {4957, 4, 0, 0x2016},
+    {4961, 11, 0, 0x2223}, {4972, 12, 0, 0x7C}, {4984, 17, 0, 0x2758}, {5001, 13, 0, 0x2240},
+    {5014, 13, 0, 0x200A}, {5027, 3, 0, 0x1D519}, {5030, 4, 0, 0x1D54D}, {5034, 4, 0, 0x1D4B1},
+    {5038, 6, 0, 0x22AA}, {5044, 5, 0, 0x174}, {5049, 5, 0, 0x22C0}, {5054, 3, 0, 0x1D51A},
+    {5057, 4, 0, 0x1D54E}, {5061, 4, 0, 0x1D4B2}, {5065, 3, 0, 0x1D51B}, {5068, 2, 0, 0x39E},
+    {5070, 4, 0, 0x1D54F}, {5074, 4, 0, 0x1D4B3}, {5078, 4, 0, 0x42F}, {5082, 4, 0, 0x407},
+    {5086, 4, 0, 0x42E}, {5090, 6, 0, 0xDD}, {5096, 5, 0, 0x176}, {5101, 3, 0, 0x42B},
+    {5104, 3, 0, 0x1D51C}, {5107, 4, 0, 0x1D550}, {5111, 4, 0, 0x1D4B4}, {5115, 4, 0, 0x178},
+    {5119, 4, 0, 0x416}, {5123, 6, 0, 0x179}, {5129, 6, 0, 0x17D}, {5135, 3, 0, 0x417},
+    {5138, 4, 0, 0x17B}, {5142, 14, 0, 0x200B}, {5156, 4, 0, 0x396}, {5160, 3, 0, 0x2128},
+    {5163, 4, 0, 0x2124}, {5167, 4, 0, 0x1D4B5}, {5171, 6, 0, 0xE1}, {5177, 6, 0, 0x103},
+    {5183, 2, 0, 0x223E}, {5185, 3, 3, 0x223E}, {5188, 3, 0, 0x223F}, {5191, 5, 0, 0xE2},
+    {5196, 5, 0, 0xB4}, {5201, 3, 0, 0x430}, {5204, 5, 0, 0xE6}, {5209, 2, 0, 0x2061},
+    {5211, 3, 0, 0x1D51E}, {5214, 6, 0, 0xE0}, {5220, 7, 0, 0x2135}, {5227, 5, 0, 0x2135},
+    {5232, 5, 0, 0x3B1}, {5237, 5, 0, 0x101}, {5242, 5, 0, 0x2A3F}, {5247, 3, 0, 0x26},
+    {5250, 3, 0, 0x2227}, {5253, 6, 0, 0x2A55}, {5259, 4, 0, 0x2A5C}, {5263, 8, 0, 0x2A58},
+    {5271, 4, 0, 0x2A5A}, {5275, 3, 0, 0x2220}, {5278, 4, 0, 0x29A4}, {5282, 5, 0, 0x2220},
+    {5287, 6, 0, 0x2221}, {5293, 8, 0, 0x29A8}, {5301, 8, 0, 0x29A9}, {5309, 8, 0, 0x29AA},
+    {5317, 8, 0, 0x29AB}, {5325, 8, 0, 0x29AC}, {5333, 8, 0, 0x29AD}, {5341, 8, 0, 0x29AE},
+    {5349, 8, 0, 0x29AF}, {5357, 5, 0, 0x221F}, {5362, 7, 0, 0x22BE}, {5369, 8, 0, 0x299D},
+    {5377, 6, 0, 0x2222}, {5383, 5, 0, 0xC5}, {5388, 7, 0, 0x237C}, {5395, 5, 0, 0x105},
+    {5400, 4, 0, 0x1D552}, {5404, 2, 0, 0x2248}, {5406, 3, 0, 0x2A70}, {5409, 6, 0, 0x2A6F},
+    {5415, 3, 0, 0x224A}, {5418, 4, 0, 0x224B}, {5422, 4, 0, 0x27}, {5426, 6, 0, 0x2248},
+    {5432, 8, 0, 0x224A}, {5440, 5, 0, 0xE5}, {5445, 4, 0, 0x1D4B6}, {5449, 3, 0, 0x2A},
+    {5452, 5, 0, 0x2248}, {5457, 7, 0, 0x224D}, {5464, 6, 0, 0xE3}, {5470, 4, 0, 0xE4},
+    {5474, 8, 0, 0x2233}, {5482, 5, 0, 0x2A11}, {5487, 4, 0, 0x2AED}, {5491, 8, 0, 0x224C},
+    {5499, 11, 0, 0x3F6}, {5510, 9, 0, 0x2035}, {5519, 7, 0, 0x223D}, {5526, 9, 0, 0x22CD},
+    {5535, 6, 0, 0x22BD}, {5541, 6, 0, 0x2305}, {5547, 8, 0, 0x2305}, {5555, 4, 0, 0x23B5},
+    {5559, 8, 0, 0x23B6}, {5567, 5, 0, 0x224C}, {5572, 3, 0, 0x431}, {5575, 5, 0, 0x201E},
+    {5580, 6, 0, 0x2235}, {5586, 7, 0, 0x2235}, {5593, 7, 0, 0x29B0}, {5600, 5, 0, 0x3F6},
+    {5605, 6, 0, 0x212C}, {5611, 4, 0, 0x3B2}, {5615, 4, 0, 0x2136}, {5619, 7, 0, 0x226C},
+    {5626, 3, 0, 0x1D51F}, {5629, 6, 0, 0x22C2}, {5635, 7, 0, 0x25EF}, {5642, 6, 0, 0x22C3},
+    {5648, 7, 0, 0x2A00}, {5655, 8, 0, 0x2A01}, {5663, 9, 0, 0x2A02}, {5672, 8, 0, 0x2A06},
+    {5680, 7, 0, 0x2605}, {5687, 15, 0, 0x25BD}, {5702, 13, 0, 0x25B3}, {5715, 8, 0, 0x2A04},
+    {5723, 6, 0, 0x22C1}, {5729, 8, 0, 0x22C0}, {5737, 6, 0, 0x290D}, {5743, 12, 0, 0x29EB},
+    {5755, 11, 0, 0x25AA}, {5766, 13, 0, 0x25B4}, {5779, 17, 0, 0x25BE}, {5796, 17, 0, 0x25C2},
+    {5813, 18, 0, 0x25B8}, {5831, 5, 0, 0x2423}, {5836, 5, 0, 0x2592}, {5841, 5, 0, 0x2591},
+    {5846, 5, 0, 0x2593}, {5851, 5, 0, 0x2588}, {5856, 3, 7, 0x3D}, {5859, 7, 7, 0x2261},
+    {5866, 4, 0, 0x2310}, {5870, 4, 0, 0x1D553}, {5874, 3, 0, 0x22A5}, {5877, 6, 0, 0x22A5},
+    {5883, 6, 0, 0x22C8}, {5889, 5, 0, 0x2557}, {5894, 5, 0, 0x2554}, {5899, 5, 0, 0x2556},
+    {5904, 5, 0, 0x2553}, {5909, 4, 0, 0x2550}, {5913, 5, 0, 0x2566}, {5918, 5, 0, 0x2569},
+    {5923, 5, 0, 0x2564}, {5928, 5, 0, 0x2567}, {5933, 5, 0, 0x255D}, {5938, 5, 0, 0x255A},
+    {5943, 5, 0, 0x255C}, {5948, 5, 0, 0x2559}, {5953, 4, 0, 0x2551}, {5957, 5, 0, 0x256C},
+    {5962, 5, 0, 0x2563}, {5967, 5, 0, 0x2560}, {5972, 5, 0, 0x256B}, {5977, 5, 0, 0x2562},
+    {5982, 5, 0, 0x255F}, {5987, 6, 0, 0x29C9}, {5993, 5, 0, 0x2555}, {5998, 5, 0, 0x2552},
+    {6003, 5, 0, 0x2510}, {6008, 5, 0, 0x250C}, {6013, 4, 0, 0x2500}, {6017, 5, 0, 0x2565},
+    {6022, 5, 0, 0x2568}, {6027, 5, 0, 0x252C}, {6032, 5, 0, 0x2534}, {6037, 8, 0, 0x229F},
+    {6045, 7, 0, 0x229E}, {6052, 8, 0, 0x22A0}, {6060, 5, 0, 0x255B}, {6065, 5, 0, 0x2558},
+    {6070, 5, 0, 0x2518}, {6075, 5, 0, 0x2514}, {6080, 4, 0, 0x2502}, {6084, 5, 0, 0x256A},
+    {6089, 5, 0, 0x2561}, {6094, 5, 0, 0x255E}, {6099, 5, 0, 0x253C}, {6104, 5, 0, 0x2524},
+    {6109, 5, 0, 0x251C}, {6114, 6, 0, 0x2035}, {6120, 5, 0, 0x2D8}, {6125, 6, 0, 0xA6},
+    {6131, 4, 0, 0x1D4B7}, {6135, 5, 0, 0x204F}, {6140, 4, 0, 0x223D}, {6144, 5, 0, 0x22CD},
+    {6149, 4, 0, 0x5C}, {6153, 5, 0, 0x29C5}, {6158, 8, 0, 0x27C8}, {6166, 4, 0, 0x2022},
+    {6170, 6, 0, 0x2022}, {6176, 4, 0, 0x224E}, {6180, 5, 0, 0x2AAE}, {6185, 5, 0, 0x224F},
+    {6190, 6, 0, 0x224F}, {6196, 6, 0, 0x107}, {6202, 3, 0, 0x2229}, {6205, 6, 0, 0x2A44},
+    {6211, 8, 0, 0x2A49}, {6219, 6, 0, 0x2A4B}, {6225, 6, 0, 0x2A47}, {6231, 6, 0, 0x2A40},
+    {6237, 4, 8, 0x2229}, {6241, 5, 0, 0x2041}, {6246, 5, 0, 0x2C7}, {6251, 5, 0, 0x2A4D},
+    {6256, 6, 0, 0x10D}, {6262, 6, 0, 0xE7}, {6268, 5, 0, 0x109}, {6273, 5, 0, 0x2A4C},
+    {6278, 7, 0, 0x2A50}, {6285, 4, 0, 0x10B}, {6289, 5, 0, 0xB8}, {6294, 7, 0, 0x29B2},
+    {6301, 4, 0, 0xA2}, {6305, 9, 0, 0xB7}, {6314, 3, 0, 0x1D520}, {6317, 4, 0, 0x447},
+    {6321, 5, 0, 0x2713}, {6326, 9, 0, 0x2713}, {6335, 3, 0, 0x3C7}, {6338, 3, 0, 0x25CB},
+    {6341, 4, 0, 0x29C3}, {6345, 4, 0, 0x2C6}, {6349, 6, 0, 0x2257}, {6355, 15, 0, 0x21BA},
+    {6370, 16, 0, 0x21BB}, {6386, 8, 0, 0xAE}, {6394, 8, 0, 0x24C8}, {6402, 10, 0, 0x229B},
+    {6412, 11, 0, 0x229A}, {6423, 11, 0, 0x229D}, {6434, 4, 0, 0x2257}, {6438, 8, 0, 0x2A10},
+    {6446, 6, 0, 0x2AEF}, {6452, 7, 0, 0x29C2}, {6459, 5, 0, 0x2663}, {6464, 8, 0, 0x2663},
+    {6472, 5, 0, 0x3A}, {6477, 6, 0, 0x2254}, {6483, 7, 0, 0x2254}, {6490, 5, 0, 0x2C},
+    {6495, 6, 0, 0x40}, {6501, 4, 0, 0x2201}, {6505, 6, 0, 0x2218}, {6511, 10, 0, 0x2201},
+    {6521, 9, 0, 0x2102}, {6530, 4, 0, 0x2245}, {6534, 7, 0, 0x2A6D}, {6541, 6, 0, 0x222E},
+    {6547, 4, 0, 0x1D554}, {6551, 6, 0, 0x2210}, {6557, 4, 0, 0xA9}, {6561, 6, 0, 0x2117},
+    {6567, 5, 0, 0x21B5}, {6572, 5, 0, 0x2717}, {6577, 4, 0, 0x1D4B8}, {6581, 4, 0, 0x2ACF},
+    {6585, 5, 0, 0x2AD1}, {6590, 4, 0, 0x2AD0}, {6594, 5, 0, 0x2AD2}, {6599, 5, 0, 0x22EF},
+    {6604, 7, 0, 0x2938}, {6611, 7, 0, 0x2935}, {6618, 5, 0, 0x22DE}, {6623, 5, 0, 0x22DF},
+    {6628, 6, 0, 0x21B6}, {6634, 7, 0, 0x293D}, {6641, 3, 0, 0x222A}, {6644, 8, 0, 0x2A48},
+    {6652, 6, 0, 0x2A46}, {6658, 6, 0, 0x2A4A}, {6664, 6, 0, 0x228D}, {6670, 5, 0, 0x2A45},
+    {6675, 4, 8, 0x222A}, {6679, 6, 0, 0x21B7}, {6685, 7, 0, 0x293C}, {6692, 11, 0, 0x22DE},
+    {6703, 11, 0, 0x22DF}, {6714, 8, 0, 0x22CE}, {6722, 10, 0, 0x22CF}, {6732, 6, 0, 0xA4},
+    {6738, 14, 0, 0x21B6}, {6752, 15, 0, 0x21B7}, {6767, 5, 0, 0x22CE}, {6772, 5, 0, 0x22CF},
+    {6777, 8, 0, 0x2232}, {6785, 5, 0, 0x2231}, {6790, 6, 0, 0x232D}, {6796, 4, 0, 0x21D3},
+    {6800, 4, 0, 0x2965}, {6804, 6, 0, 0x2020}, {6810, 6, 0, 0x2138}, {6816, 4, 0, 0x2193},
+    {6820, 4, 0, 0x2010}, {6824, 5, 0, 0x22A3}, {6829, 7, 0, 0x290F}, {6836, 5, 0, 0x2DD},
+    {6841, 6, 0, 0x10F}, {6847, 3, 0, 0x434}, {6850, 2, 0, 0x2146}, {6852, 7, 0, 0x2021},
+    {6859, 5, 0, 0x21CA}, {6864, 7, 0, 0x2A77}, {6871, 3, 0, 0xB0}, {6874, 5, 0, 0x3B4},
+    {6879, 7, 0, 0x29B1}, {6886, 6, 0, 0x297F}, {6892, 3, 0, 0x1D521}, {6895, 5, 0, 0x21C3},
+    {6900, 5, 0, 0x21C2}, {6905, 4, 0, 0x22C4}, {6909, 7, 0, 0x22C4}, {6916, 11, 0, 0x2666},
+    {6927, 5, 0, 0x2666}, {6932, 3, 0, 0xA8}, {6935, 7, 0, 0x3DD}, {6942, 5, 0, 0x22F2},
+    {6947, 3, 0, 0xF7}, {6950, 6, 0, 0xF7}, {6956, 13, 0, 0x22C7}, {6969, 6, 0, 0x22C7},
+    {6975, 4, 0, 0x452}, {6979, 6, 0, 0x231E}, {6985, 6, 0, 0x230D}, {6991, 6, 0, 0x24},
+    {6997, 4, 0, 0x1D555}, {7001, 3, 0, 0x2D9}, {7004, 5, 0, 0x2250}, {7009, 8, 0, 0x2251},
+    {7017, 8, 0, 0x2238}, {7025, 7, 0, 0x2214}, {7032, 9, 0, 0x22A1}, {7041, 14, 0, 0x2306},
+    {7055, 9, 0, 0x2193}, {7064, 14, 0, 0x21CA}, {7078, 15, 0, 0x21C3}, {7093, 16, 0, 0x21C2},
+    {7109, 8, 0, 0x2910}, {7117, 6, 0, 0x231F}, {7123, 6, 0, 0x230C}, {7129, 4, 0, 0x1D4B9},
+    {7133, 4, 0, 0x455}, {7137, 4, 0, 0x29F6}, {7141, 6, 0, 0x111}, {7147, 5, 0, 0x22F1},
+    {7152, 4, 0, 0x25BF}, {7156, 5, 0, 0x25BE}, {7161, 5, 0, 0x21F5}, {7166, 5, 0, 0x296F},
+    {7171, 7, 0, 0x29A6}, {7178, 4, 0, 0x45F}, {7182, 8, 0, 0x27FF}, {7190, 5, 0, 0x2A77},
+    {7195, 4, 0, 0x2251}, {7199, 6, 0, 0xE9}, {7205, 6, 0, 0x2A6E}, {7211, 6, 0, 0x11B},
+    {7217, 4, 0, 0x2256}, {7221, 5, 0, 0xEA}, {7226, 6, 0, 0x2255}, {7232, 3, 0, 0x44D},
+    {7235, 4, 0, 0x117}, {7239, 2, 0, 0x2147}, {7241, 5, 0, 0x2252}, {7246, 3, 0, 0x1D522},
+    {7249, 2, 0, 0x2A9A}, {7251, 6, 0, 0xE8}, {7257, 3, 0, 0x2A96}, {7260, 6, 0, 0x2A98},
+    {7266, 2, 0, 0x2A99}, {7268, 8, 0, 0x23E7}, {7276, 3, 0, 0x2113}, {7279, 3, 0, 0x2A95},
+    {7282, 6, 0, 0x2A97}, {7288, 5, 0, 0x113}, {7293, 5, 0, 0x2205}, {7298, 8, 0, 0x2205},
+    {7306, 6, 0, 0x2205}, {7312, 4, 0, 0x2003}, {7316, 6, 0, 0x2004}, {7322, 6, 0, 0x2005},
+    {7328, 3, 0, 0x14B}, {7331, 4, 0, 0x2002}, {7335, 5, 0, 0x119}, {7340, 4, 0, 0x1D556},
+    {7344, 4, 0, 0x22D5}, {7348, 6, 0, 0x29E3}, {7354, 5, 0, 0x2A71}, {7359, 4, 0, 0x3B5},
+    {7363, 7, 0, 0x3B5}, {7370, 5, 0, 0x3F5}, {7375, 6, 0, 0x2256}, {7381, 7, 0, 0x2255},
+    {7388, 5, 0, 0x2242}, {7393, 10, 0, 0x2A96}, {7403, 11, 0, 0x2A95}, {7414, 6, 0, 0x3D},
+    {7420, 6, 0, 0x225F}, {7426, 5, 0, 0x2261}, {7431, 7, 0, 0x2A78}, {7438, 8, 0, 0x29E5},
+    {7446, 5, 0, 0x2253}, {7451, 5, 0, 0x2971}, {7456, 4, 0, 0x212F}, {7460, 5, 0, 0x2250},
+    {7465, 4, 0, 0x2242}, {7469, 3, 0, 0x3B7}, {7472, 3, 0, 0xF0}, {7475, 4, 0, 0xEB},
+    {7479, 4, 0, 0x20AC}, {7483, 4, 0, 0x21}, {7487, 5, 0, 0x2203}, {7492, 11, 0, 0x2130},
+    {7503, 12, 0, 0x2147}, {7515, 13, 0, 0x2252}, {7528, 3, 0, 0x444}, {7531, 6, 0, 0x2640},
+    {7537, 6, 0, 0xFB03}, {7543, 5, 0, 0xFB00}, {7548, 6, 0, 0xFB04}, {7554, 3, 0, 0x1D523},
+    {7557, 5, 0, 0xFB01}, {7562, 5, 1, 0x66}, {7567, 4, 0, 0x266D}, {7571, 5, 0, 0xFB02},
+    {7576, 5, 0, 0x25B1}, {7581, 4, 0, 0x192}, {7585, 4, 0, 0x1D557}, {7589, 6, 0, 0x2200},
+    {7595, 4, 0, 0x22D4}, {7599, 5, 0, 0x2AD9}, {7604, 8, 0, 0x2A0D}, {7612, 6, 0, 0xBD},
+    {7618, 6, 0, 0x2153}, {7624, 6, 0, 0xBC}, {7630, 6, 0, 0x2155}, {7636, 6, 0, 0x2159},
+    {7642, 6, 0, 0x215B}, {7648, 6, 0, 0x2154}, {7654, 6, 0, 0x2156}, {7660, 6, 0, 0xBE},
+    {7666, 6, 0, 0x2157}, {7672, 6, 0, 0x215C}, {7678, 6, 0, 0x2158}, {7684, 6, 0, 0x215A},
+    {7690, 6, 0, 0x215D}, {7696, 6, 0, 0x215E}, {7702, 5, 0, 0x2044}, {7707, 5, 0, 0x2322},
+    {7712, 4, 0, 0x1D4BB}, {7716, 2, 0, 0x2267}, {7718, 3, 0, 0x2A8C}, {7721, 6, 0, 0x1F5},
+    {7727, 5, 0, 0x3B3}, {7732, 6, 0, 0x3DD}, {7738, 3, 0, 0x2A86}, {7741, 6, 0, 0x11F},
+    {7747, 5, 0, 0x11D}, {7752, 3, 0, 0x433}, {7755, 4, 0, 0x121}, {7759, 2, 0, 0x2265},
+    {7761, 3, 0, 0x22DB}, {7764, 3, 0, 0x2265}, {7767, 4, 0, 0x2267}, {7771, 8, 0, 0x2A7E},
+    {7779, 3, 0, 0x2A7E}, {7782, 5, 0, 0x2AA9}, {7787, 6, 0, 0x2A80}, {7793, 7, 0, 0x2A82},
+    {7800, 8, 0, 0x2A84}, {7808, 4, 8, 0x22DB}, {7812, 6, 0, 0x2A94}, {7818, 3, 0, 0x1D524},
+    {7821, 2, 0, 0x226B}, {7823, 3, 0, 0x22D9}, {7826, 5, 0, 0x2137}, {7831, 4, 0, 0x453},
+    {7835, 2, 0, 0x2277}, {7837, 3, 0, 0x2A92}, {7840, 3, 0, 0x2AA5}, {7843, 3, 0, 0x2AA4},
+    {7846, 3, 0, 0x2269}, {7849, 4, 0, 0x2A8A}, {7853, 8, 0, 0x2A8A}, {7861, 3, 0, 0x2A88},
+    {7864, 4, 0, 0x2A88}, {7868, 5, 0, 0x2269}, {7873, 5, 0, 0x22E7}, {7878, 4, 0, 0x1D558},
+    {7882, 5, 0, 0x60}, {7887, 4, 0, 0x210A}, {7891, 4, 0, 0x2273}, {7895, 5, 0, 0x2A8E},
+    {7900, 5, 0, 0x2A90}, {7905, 2, 0, 0x3E}, {7907, 4, 0, 0x2AA7}, {7911, 5, 0, 0x2A7A},
+    {7916, 5, 0, 0x22D7}, {7921, 6, 0, 0x2995}, {7927, 7, 0, 0x2A7C}, {7934, 9, 0, 0x2A86},
+    {7943, 6, 0, 0x2978}, {7949, 6, 0, 0x22D7}, {7955, 9, 0, 0x22DB}, {7964, 10, 0, 0x2A8C},
+    {7974, 7, 0, 0x2277}, {7981, 6, 0, 0x2273}, {7987, 9, 8, 0x2269}, {7996, 4, 8, 0x2269},
+    {8000, 4, 0, 0x21D4}, {8004, 6, 0, 0x200A}, {8010, 4, 0, 0xBD}, {8014, 6, 0, 0x210B},
+    {8020, 6, 0, 0x44A}, {8026, 4, 0, 0x2194}, {8030, 7, 0, 0x2948}, {8037, 5, 0, 0x21AD},
+    {8042, 4, 0, 0x210F}, {8046, 5, 0, 0x125}, {8051, 6, 0, 0x2665}, {8057, 9, 0, 0x2665},
+    {8066, 6, 0, 0x2026}, {8072, 6, 0, 0x22B9}, {8078, 3, 0, 0x1D525}, {8081, 8, 0, 0x2925},
+    {8089, 8, 0, 0x2926}, {8097, 5, 0, 0x21FF}, {8102, 6, 0, 0x223B}, {8108, 13, 0, 0x21A9},
+    {8121, 14, 0, 0x21AA}, {8135, 4, 0, 0x1D559}, {8139, 6, 0, 0x2015}, {8145, 4, 0, 0x1D4BD},
+    {8149, 6, 0, 0x210F}, {8155, 6, 0, 0x127}, {8161, 6, 0, 0x2043}, {8167, 6, 0, 0x2010},
+    {8173, 6, 0, 0xED}, {8179, 2, 0, 0x2063}, {8181, 5, 0, 0xEE}, {8186, 3, 0, 0x438},
+    {8189, 4, 0, 0x435}, {8193, 5, 0, 0xA1}, {8198, 3, 0, 0x21D4}, {8201, 3, 0, 0x1D526},
+    {8204, 6, 0, 0xEC}, {8210, 2, 0, 0x2148}, {8212, 6, 0, 0x2A0C}, {8218, 5, 0, 0x222D},
+    {8223, 6, 0, 0x29DC}, {8229, 5, 0, 0x2129}, {8234, 5, 0, 0x133}, {8239, 5, 0, 0x12B},
+    {8244, 5, 0, 0x2111}, {8249, 8, 0, 0x2110}, {8257, 8, 0, 0x2111}, {8265, 5, 0, 0x131},
+    {8270, 4, 0, 0x22B7}, {8274, 5, 0, 0x1B5}, {8279, 2, 0, 0x2208}, {8281, 6, 0, 0x2105},
+    {8287, 5, 0, 0x221E}, {8292, 8, 0, 0x29DD}, {8300, 6, 0, 0x131}, {8306, 3, 0, 0x222B},
+    {8309, 6, 0, 0x22BA}, {8315, 8, 0, 0x2124}, {8323, 8, 0, 0x22BA}, {8331, 8, 0, 0x2A17},
+    {8339, 7, 0, 0x2A3C}, {8346, 4, 0, 0x451}, {8350, 5, 0, 0x12F}, {8355, 4, 0, 0x1D55A},
+    {8359, 4, 0, 0x3B9}, {8363, 5, 0, 0x2A3C}, {8368, 6, 0, 0xBF}, {8374, 4, 0, 0x1D4BE},
+    {8378, 4, 0, 0x2208}, {8382, 5, 0, 0x22F9}, {8387, 7, 0, 0x22F5}, {8394, 5, 0, 0x22F4},
+    {8399, 6, 0, 0x22F3}, {8405, 5, 0, 0x2208}, {8410, 2, 0, 0x2062}, {8412, 6, 0, 0x129},
+    {8418, 5, 0, 0x456}, {8423, 4, 0, 0xEF}, {8427, 5, 0, 0x135}, {8432, 3, 0, 0x439},
+    {8435, 3, 0, 0x1D527}, {8438, 5, 0, 0x237}, {8443, 4, 0, 0x1D55B}, {8447, 4, 0, 0x1D4BF},
+    {8451, 6, 0, 0x458}, {8457, 5, 0, 0x454}, {8462, 5, 0, 0x3BA}, {8467, 6, 0, 0x3F0},
+    {8473, 6, 0, 0x137}, {8479, 3, 0, 0x43A}, {8482, 3, 0, 0x1D528}, {8485, 6, 0, 0x138},
+    {8491, 4, 0, 0x445}, {8495, 4, 0, 0x45C}, {8499, 4, 0, 0x1D55C}, {8503, 4, 0, 0x1D4C0},
+    {8507, 5, 0, 0x21DA}, {8512, 4, 0, 0x21D0}, {8516, 6, 0, 0x291B}, {8522, 5, 0, 0x290E},
+    {8527, 2, 0, 0x2266}, {8529, 3, 0, 0x2A8B}, {8532, 4, 0, 0x2962}, {8536, 6, 0, 0x13A},
+    {8542, 8, 0, 0x29B4}, {8550, 6, 0, 0x2112}, {8556, 6, 0, 0x3BB}, {8562, 4, 0, 0x27E8},
+    {8566, 5, 0, 0x2991}, {8571, 6, 0, 0x27E8}, {8577, 3, 0, 0x2A85}, {8580, 5, 0, 0xAB},
+    {8585, 4, 0, 0x2190}, {8589, 5, 0, 0x21E4}, {8594, 7, 0, 0x291F}, {8601, 6, 0, 0x291D},
+    {8607, 6, 0, 0x21A9}, {8613, 6, 0, 0x21AB}, {8619, 6, 0, 0x2939}, {8625, 7, 0, 0x2973},
+    {8632, 6, 0, 0x21A2}, {8638, 3, 0, 0x2AAB}, {8641, 6, 0, 0x2919}, {8647, 4, 0, 0x2AAD},
+    {8651, 5, 8, 0x2AAD}, {8656, 5, 0, 0x290C}, {8661, 5, 0, 0x2772}, {8666, 6, 0, 0x7B},
+    {8672, 6, 0, 0x5B}, {8678, 5, 0, 0x298B}, {8683, 7, 0, 0x298F}, {8690, 7, 0, 0x298D},
+    {8697, 6, 0, 0x13E}, {8703, 6, 0, 0x13C}, {8709, 5, 0, 0x2308}, {8714, 4, 0, 0x7B},
+    {8718, 3, 0, 0x43B}, {8721, 4, 0, 0x2936}, {8725, 5, 0, 0x201C}, {8730, 6, 0, 0x201E},
+    {8736, 7, 0, 0x2967}, {8743, 8, 0, 0x294B}, {8751, 4, 0, 0x21B2}, {8755, 2, 0, 0x2264},
+    {8757, 9, 0, 0x2190}, {8766, 13, 0, 0x21A2}, {8779, 15, 0, 0x21BD}, {8794, 13, 0, 0x21BC},
+    {8807, 14, 0, 0x21C7}, {8821, 14, 0, 0x2194}, {8835, 15, 0, 0x21C6}, {8850, 17, 0, 0x21CB},
+    {8867, 19, 0, 0x21AD}, {8886, 14, 0, 0x22CB}, {8900, 3, 0, 0x22DA}, {8903, 3, 0, 0x2264},
+    {8906, 4, 0, 0x2266}, {8910, 8, 0, 0x2A7D}, {8918, 3, 0, 0x2A7D}, {8921, 5, 0, 0x2AA8},
+    {8926, 6, 0, 0x2A7F}, {8932, 7, 0, 0x2A81}, {8939, 8, 0, 0x2A83}, {8947, 4, 8, 0x22DA},
+    {8951, 6, 0, 0x2A93}, {8957, 10, 0, 0x2A85}, {8967, 7, 0, 0x22D6}, {8974, 9, 0, 0x22DA},
+    {8983, 10, 0, 0x2A8B}, {8993, 7, 0, 0x2276}, {9000, 7, 0, 0x2272}, {9007, 6, 0, 0x297C},
+    {9013, 6, 0, 0x230A}, {9019, 3, 0, 0x1D529}, {9022, 2, 0, 0x2276}, {9024, 3, 0, 0x2A91},
+    {9027, 5, 0, 0x21BD}, {9032, 5, 0, 0x21BC}, {9037, 6, 0, 0x296A}, {9043, 5, 0, 0x2584},
+    {9048, 4, 0, 0x459}, {9052, 2, 0, 0x226A}, {9054, 5, 0, 0x21C7}, {9059, 8, 0, 0x231E},
+    {9067, 6, 0, 0x296B}, {9073, 5, 0, 0x25FA}, {9078, 6, 0, 0x140}, {9084, 6, 0, 0x23B0},
+    {9090, 10, 0, 0x23B0}, {9100, 3, 0, 0x2268}, {9103, 4, 0, 0x2A89}, {9107, 8, 0, 0x2A89},
+    {9115, 3, 0, 0x2A87}, {9118, 4, 0, 0x2A87}, {9122, 5, 0, 0x2268}, {9127, 5, 0, 0x22E6},
+    {9132, 5, 0, 0x27EC}, {9137, 5, 0, 0x21FD}, {9142, 5, 0, 0x27E6}, {9147, 13, 0, 0x27F5},
+    {9160, 18, 0, 0x27F7}, {9178, 10, 0, 0x27FC}, {9188, 14, 0, 0x27F6}, {9202, 13, 0, 0x21AB},
+    {9215, 14, 0, 0x21AC}, {9229, 5, 0, 0x2985}, {9234, 4, 0, 0x1D55D}, {9238, 6, 0, 0x2A2D},
+    {9244, 7, 0, 0x2A34}, {9251, 6, 0, 0x2217}, {9257, 6, 0, 0x5F}, {9263, 3, 0, 0x25CA},
+    {9266, 7, 0, 0x25CA}, {9273, 4, 0, 0x29EB}, {9277, 4, 0, 0x28}, {9281, 6, 0, 0x2993},
+    {9287, 5, 0, 0x21C6}, {9292, 8, 0, 0x231F}, {9300, 5, 0, 0x21CB}, {9305, 6, 0, 0x296D},
+    {9311, 3, 0, 0x200E}, {9314, 5, 0, 0x22BF}, {9319, 6, 0, 0x2039}, {9325, 4, 0, 0x1D4C1},
+    {9329, 3, 0, 0x21B0}, {9332, 4, 0, 0x2272}, {9336, 5, 0, 0x2A8D}, {9341, 5, 0, 0x2A8F},
+    {9346, 4, 0, 0x5B}, {9350, 5, 0, 0x2018}, {9355, 6, 0, 0x201A}, {9361, 6, 0, 0x142},
+    {9367, 2, 0, 0x3C}, {9369, 4, 0, 0x2AA6}, {9373, 5, 0, 0x2A79}, {9378, 5, 0, 0x22D6},
+    {9383, 6, 0, 0x22CB}, {9389, 6, 0, 0x22C9}, {9395, 6, 0, 0x2976}, {9401, 7, 0, 0x2A7B},
+    {9408, 6, 0, 0x2996}, {9414, 4, 0, 0x25C3}, {9418, 5, 0, 0x22B4}, {9423, 5, 0, 0x25C2},
+    {9428, 8, 0, 0x294A}, {9436, 7, 0, 0x2966}, {9443, 9, 8, 0x2268}, {9452, 4, 8, 0x2268},
+    {9456, 5, 0, 0x223A}, {9461, 4, 0, 0xAF}, {9465, 4, 0, 0x2642}, {9469, 4, 0, 0x2720},
+    {9473, 7, 0, 0x2720}, {9480, 3, 0, 0x21A6}, {9483, 6, 0, 0x21A6}, {9489, 10, 0, 0x21A7},
+    {9499, 10, 0, 0x21A4}, {9509, 8, 0, 0x21A5}, {9517, 6, 0, 0x25AE}, {9523, 6, 0, 0x2A29},
+    {9529, 3, 0, 0x43C}, {9532, 5, 0, 0x2014}, {9537, 13, 0, 0x2221}, {9550, 3, 0, 0x1D52A},
+    {9553, 3, 0, 0x2127}, {9556, 5, 0, 0xB5}, {9561, 3, 0, 0x2223}, {9564, 6, 0, 0x2A},
+    {9570, 6, 0, 0x2AF0}, {9576, 6, 0, 0xB7}, {9582, 5, 0, 0x2212}, {9587, 6, 0, 0x229F},
+    {9593, 6, 0, 0x2238}, {9599, 7, 0, 0x2A2A}, {9606, 4, 0, 0x2ADB}, {9610, 4, 0, 0x2026},
+    {9614, 6, 0, 0x2213}, {9620, 6, 0, 0x22A7}, {9626, 4, 0, 0x1D55E}, {9630, 2, 0, 0x2213},
+    {9632, 4, 0, 0x1D4C2}, {9636, 6, 0, 0x223E}, {9642, 2, 0, 0x3BC}, {9644, 8, 0, 0x22B8},
+    {9652, 5, 0, 0x22B8}, {9657, 3, 4, 0x22D9}, {9660, 3, 6, 0x226B}, {9663, 4, 4, 0x226B},
+    {9667, 10, 0, 0x21CD}, {9677, 15, 0, 0x21CE}, {9692, 3, 4, 0x22D8}, {9695, 3, 6, 0x226A},
+    {9698, 4, 4, 0x226A}, {9702, 11, 0, 0x21CF}, {9713, 6, 0, 0x22AF}, {9719, 6, 0, 0x22AE},
+    {9725, 5, 0, 0x2207}, {9730, 6, 0, 0x144}, {9736, 4, 6, 0x2220}, {9740, 3, 0, 0x2249},
+    {9743, 4, 4, 0x2A70}, {9747, 5, 4, 0x224B}, {9752, 5, 0, 0x149}, {9757, 7, 0, 0x2249},
+    {9764, 5, 0, 0x266E}, {9769, 7, 0, 0x266E}, {9776, 8, 0, 0x2115}, {9784, 4, 0, 0xA0},
+    {9788, 5, 4, 0x224E}, {9793, 6, 4, 0x224F}, {9799, 4, 0, 0x2A43}, {9803, 6, 0, 0x148},
+    {9809, 6, 0, 0x146}, {9815, 5, 0, 0x2247}, {9820, 8, 4, 0x2A6D}, {9828, 4, 0, 0x2A42},
+    {9832, 3, 0, 0x43D}, {9835, 5, 0, 0x2013}, {9840, 2, 0, 0x2260}, {9842, 5, 0, 0x21D7},
+    {9847, 6, 0, 0x2924}, {9853, 5, 0, 0x2197}, {9858, 7, 0, 0x2197}, {9865, 5, 4, 0x2250},
+    {9870, 6, 0, 0x2262}, {9876, 6, 0, 0x2928}, {9882, 5, 4, 0x2242}, {9887, 6, 0, 0x2204},
+    {9893, 7, 0, 0x2204}, {9900, 3, 0, 0x1D52B}, {9903, 3, 4, 0x2267}, {9906, 3, 0, 0x2271},
+    {9909, 4, 0, 0x2271}, {9913, 5, 4, 0x2267}, {9918, 9, 4, 0x2A7E}, {9927, 4, 4, 0x2A7E},
+    {9931, 5, 0, 0x2275}, {9936, 3, 0, 0x226F}, {9939, 4, 0, 0x226F}, {9943, 5, 0, 0x21CE},
+    {9948, 5, 0, 0x21AE}, {9953, 5, 0, 0x2AF2}, {9958, 2, 0, 0x220B}, {9960, 3, 0, 0x22FC},
+    {9963, 4, 0, 0x22FA}, {9967, 3, 0, 0x220B}, {9970, 4, 0, 0x45A}, {9974, 5, 0, 0x21CD},
+    {9979, 3, 4, 0x2266}, {9982, 5, 0, 0x219A}, {9987, 4, 0, 0x2025}, {9991, 3, 0, 0x2270},
+    {9994, 10, 0, 0x219A}, {10004, 15, 0, 0x21AE}, {10019, 4, 0, 0x2270}, {10023, 5, 4, 0x2266},
+    {10028, 9, 4, 0x2A7D}, {10037, 4, 4, 0x2A7D}, {10041, 5, 0, 0x226E}, {10046, 5, 0, 0x2274},
+    {10051, 3, 0, 0x226E}, {10054, 5, 0, 0x22EA}, {10059, 6, 0, 0x22EC}, {10065, 4, 0, 0x2224},
+    {10069, 4, 0, 0x1D55F}, {10073, 3, 0, 0xAC}, {10076, 5, 0, 0x2209}, {10081, 6, 4, 0x22F9},
+    {10087, 8, 4, 0x22F5}, {10095, 7, 0, 0x2209}, {10102, 7, 0, 0x22F7}, {10109, 7, 0, 0x22F6},
+    {10116, 5, 0, 0x220C}, {10121, 7, 0, 0x220C}, {10128, 7, 0, 0x22FE}, {10135, 7, 0, 0x22FD},
+    {10142, 4, 0, 0x2226}, {10146, 9, 0, 0x2226}, {10155, 6, 7, 0x2AFD}, {10161, 5, 4, 0x2202},
+    {10166, 7, 0, 0x2A14}, {10173, 3, 0, 0x2280}, {10176, 6, 0, 0x22E0}, {10182, 4, 4, 0x2AAF},
+    {10186, 5, 0, 0x2280}, {10191, 7, 4, 0x2AAF}, {10198, 5, 0, 0x21CF}, {10203, 5, 0, 0x219B},
+    {10208, 6, 4, 0x2933}, {10214, 6, 4, 0x219D}, {10220, 11, 0, 0x219B}, {10231, 5, 0, 0x22EB},
+    {10236, 6, 0, 0x22ED}, {10242, 3, 0, 0x2281}, {10245, 6, 0, 0x22E1}, {10251, 4, 4, 0x2AB0},
+    {10255, 4, 0, 0x1D4C3}, {10259, 9, 0, 0x2224}, {10268, 14, 0, 0x2226}, {10282, 4, 0, 0x2241},
+    {10286, 5, 0, 0x2244}, {10291, 6, 0, 0x2244}, {10297, 5, 0, 0x2224}, {10302, 5, 0, 0x2226},
+    {10307, 7, 0, 0x22E2}, {10314, 7, 0, 0x22E3}, {10321, 4, 0, 0x2284}, {10325, 5, 4, 0x2AC5},
+    {10330, 5, 0, 0x2288}, {10335, 7, 6, 0x2282}, {10342, 9, 0, 0x2288}, {10351, 10, 4, 0x2AC5},
+    {10361, 5, 0, 0x2281}, {10366, 7, 4, 0x2AB0}, {10373, 4, 0, 0x2285}, {10377, 5, 4, 0x2AC6},
+    {10382, 5, 0, 0x2289}, {10387, 7, 6, 0x2283}, {10394, 9, 0, 0x2289}, {10403, 10, 4, 0x2AC6},
+    {10413, 4, 0, 0x2279}, {10417, 6, 0, 0xF1}, {10423, 4, 0, 0x2278}, {10427, 13, 0, 0x22EA},
+    {10440, 15, 0, 0x22EC}, {10455, 14, 0, 0x22EB}, {10469, 16, 0, 0x22ED}, {10485, 2, 0, 0x3BD},
+    {10487, 3, 0, 0x23}, {10490, 6, 0, 0x2116}, {10496, 5, 0, 0x2007}, {10501, 6, 0, 0x22AD},
+    {10507, 6, 0, 0x2904}, {10513, 4, 6, 0x224D}, {10517, 6, 0, 0x22AC}, {10523, 4, 6, 0x2265},
+    {10527, 4, 6, 0x3E}, {10531, 7, 0, 0x29DE}, {10538, 6, 0, 0x2902}, {10544, 4, 6, 0x2264},
+    {10548, 4, 6, 0x3C}, {10552, 7, 6, 0x22B4}, {10559, 6, 0, 0x2903}, {10565, 7, 6, 0x22B5},
+    {10572, 5, 6, 0x223C}, {10577, 5, 0, 0x21D6}, {10582, 6, 0, 0x2923}, {10588, 5, 0, 0x2196},
+    {10593, 7, 0, 0x2196}, {10600, 6, 0, 0x2927}, {10606, 2, 0, 0x24C8}, {10608, 6, 0, 0xF3},
+    {10614, 4, 0, 0x229B}, {10618, 4, 0, 0x229A}, {10622, 5, 0, 0xF4}, {10627, 3, 0, 0x43E},
+    {10630, 5, 0, 0x229D}, {10635, 6, 0, 0x151}, {10641, 4, 0, 0x2A38}, {10645, 4, 0, 0x2299},
+    {10649, 6, 0, 0x29BC}, {10655, 5, 0, 0x153}, {10660, 5, 0, 0x29BF}, {10665, 3, 0, 0x1D52C},
+    {10668, 4, 0, 0x2DB}, {10672, 6, 0, 0xF2}, {10678, 3, 0, 0x29C1}, {10681, 5, 0, 0x29B5},
+    {10686, 3, 0, 0x3A9}, {10689, 4, 0, 0x222E}, {10693, 5, 0, 0x21BA}, {10698, 5, 0, 0x29BE},
+    {10703, 7, 0, 0x29BB}, {10710, 5, 0, 0x203E}, {10715, 3, 0, 0x29C0}, {10718, 5, 0, 0x14D},
+    {10723, 5, 0, 0x3C9}, {10728, 7, 0, 0x3BF}, {10735, 4, 0, 0x29B6}, {10739, 6, 0, 0x2296},
+    {10745, 4, 0, 0x1D560}, {10749, 4, 0, 0x29B7}, {10753, 5, 0, 0x29B9}, {10758, 5, 0, 0x2295},
+    {10763, 2, 0, 0x2228}, {10765, 5, 0, 0x21BB}, {10770, 3, 0, 0x2A5D}, {10773, 5, 0, 0x2134},
+    {10778, 7, 0, 0x2134}, {10785, 4, 0, 0xAA}, {10789, 4, 0, 0xBA}, {10793, 6, 0, 0x22B6},
+    {10799, 4, 0, 0x2A56}, {10803, 7, 0, 0x2A57}, {10810, 3, 0, 0x2A5B}, {10813, 4, 0, 0x2134},
+    {10817, 6, 0, 0xF8}, {10823, 4, 0, 0x2298}, {10827, 6, 0, 0xF5}, {10833, 6, 0, 0x2297},
+    {10839, 8, 0, 0x2A36}, {10847, 4, 0, 0xF6}, {10851, 5, 0, 0x233D}, {10856, 3, 0, 0x2225},
+    {10859, 4, 0, 0xB6}, {10863, 8, 0, 0x2225}, {10871, 6, 0, 0x2AF3}, {10877, 5, 0, 0x2AFD},
+    {10882, 4, 0, 0x2202}, {10886, 3, 0, 0x43F}, {10889, 6, 0, 0x25}, {10895, 6, 0, 0x2E},
+    {10901, 6, 0, 0x2030}, {10907, 4, 0, 0x22A5}, {10911, 7, 0, 0x2031}, {10918, 3, 0, 0x1D52D},
+    {10921, 3, 0, 0x3C6}, {10924, 4, 0, 0x3D5}, {10928, 6, 0, 0x2133}, {10934, 5, 0, 0x260E},
+    {10939, 2, 0, 0x3C0}, {10941, 9, 0, 0x22D4}, {10950, 3, 0, 0x3D6}, {10953, 6, 0, 0x210F},
+    {10959, 7, 0, 0x210E}, {10966, 6, 0, 0x210F}, {10972, 4, 0, 0x2B}, {10976, 8, 0, 0x2A23},
+    {10984, 5, 0, 0x229E}, {10989, 7, 0, 0x2A22}, {10996, 6, 0, 0x2214}, {11002, 6, 0, 0x2A25},
+    {11008, 5, 0, 0x2A72}, {11013, 6, 0, 0xB1}, {11019, 7, 0, 0x2A26}, {11026, 7, 0, 0x2A27},
+    {11033, 2, 0, 0xB1}, {11035, 8, 0, 0x2A15}, {11043, 4, 0, 0x1D561}, {11047, 5, 0, 0xA3},
+    {11052, 2, 0, 0x227A}, {11054, 3, 0, 0x2AB3}, {11057, 4, 0, 0x2AB7}, {11061, 5, 0, 0x227C},
+    {11066, 3, 0, 0x2AAF}, {11069, 4, 0, 0x227A}, {11073, 10, 0, 0x2AB7}, {11083, 11, 0, 0x227C},
+    {11094, 6, 0, 0x2AAF}, {11100, 11, 0, 0x2AB9}, {11111, 8, 0, 0x2AB5}, {11119, 8, 0, 0x22E8},
+    {11127, 7, 0, 0x227E}, {11134, 5, 0, 0x2032}, {11139, 6, 0, 0x2119}, {11145, 4, 0, 0x2AB5},
+    {11149, 5, 0, 0x2AB9}, {11154, 6, 0, 0x22E8}, {11160, 4, 0, 0x220F}, {11164, 8, 0, 0x232E},
+    {11172, 8, 0, 0x2312}, {11180, 8, 0, 0x2313}, {11188, 4, 0, 0x221D}, {11192, 6, 0, 0x221D},
+    {11198, 5, 0, 0x227E}, {11203, 6, 0, 0x22B0}, {11209, 4, 0, 0x1D4C5}, {11213, 3, 0, 0x3C8},
+    {11216, 6, 0, 0x2008}, {11222, 3, 0, 0x1D52E}, {11225, 4, 0, 0x2A0C}, {11229, 4, 0, 0x1D562},
+    {11233, 6, 0, 0x2057}, {11239, 4, 0, 0x1D4C6}, {11243, 11, 0, 0x210D}, {11254, 7, 0, 0x2A16},
+    {11261, 5, 0, 0x3F}, {11266, 7, 0, 0x225F}, {11273, 4, 0, 0x22}, {11277, 5, 0, 0x21DB},
+    {11282, 4, 0, 0x21D2}, {11286, 6, 0, 0x291C}, {11292, 5, 0, 0x290F}, {11297, 4, 0, 0x2964},
+    {11301, 4, 2, 0x223D}, {11305, 6, 0, 0x155}, {11311, 5, 0, 0x221A}, {11316, 8, 0, 0x29B3},
+    {11324, 4, 0, 0x27E9}, {11328, 5, 0, 0x2992}, {11333, 5, 0, 0x29A5}, {11338, 6, 0, 0x27E9},
+    {11344, 5, 0, 0xBB}, {11349, 4, 0, 0x2192}, {11353, 6, 0, 0x2975}, {11359, 5, 0, 0x21E5},
+    {11364, 7, 0, 0x2920}, {11371, 5, 0, 0x2933}, {11376, 6, 0, 0x291E}, {11382, 6, 0, 0x21AA},
+    {11388, 6, 0, 0x21AC}, {11394, 6, 0, 0x2945}, {11400, 7, 0, 0x2974}, {11407, 6, 0, 0x21A3},
+    {11413, 5, 0, 0x219D}, {11418, 6, 0, 0x291A}, {11424, 5, 0, 0x2236}, {11429, 9, 0, 0x211A},
+    {11438, 5, 0, 0x290D}, {11443, 5, 0, 0x2773}, {11448, 6, 0, 0x7D}, {11454, 6, 0, 0x5D},
+    {11460, 5, 0, 0x298C}, {11465, 7, 0, 0x298E}, {11472, 7, 0, 0x2990}, {11479, 6, 0, 0x159},
+    {11485, 6, 0, 0x157}, {11491, 5, 0, 0x2309}, {11496, 4, 0, 0x7D}, {11500, 3, 0, 0x440},
+    {11503, 4, 0, 0x2937}, {11507, 7, 0, 0x2969}, {11514, 5, 0, 0x201D}, {11519, 6, 0, 0x201D},
+    {11525, 4, 0, 0x21B3}, {11529, 4, 0, 0x211C}, {11533, 7, 0, 0x211B}, {11540, 8, 0, 0x211C},
+    {11548, 5, 0, 0x211D}, {11553, 4, 0, 0x25AD}, {11557, 3, 0, 0xAE}, {11560, 6, 0, 0x297D},
+    {11566, 6, 0, 0x230B}, {11572, 3, 0, 0x1D52F}, {11575, 5, 0, 0x21C1}, {11580, 5, 0, 0x21C0},
+    {11585, 6, 0, 0x296C}, {11591, 3, 0, 0x3C1}, {11594, 4, 0, 0x3F1}, {11598, 10, 0, 0x2192},
+    {11608, 14, 0, 0x21A3}, {11622, 16, 0, 0x21C1}, {11638, 14, 0, 0x21C0}, {11652, 15, 0, 0x21C4},
+    {11667, 17, 0, 0x21CC}, {11684, 16, 0, 0x21C9}, {11700, 15, 0, 0x219D}, {11715, 15, 0, 0x22CC},
+    {11730, 4, 0, 0x2DA}, {11734, 12, 0, 0x2253}, {11746, 5, 0, 0x21C4}, {11751, 5, 0, 0x21CC},
+    {11756, 3, 0, 0x200F}, {11759, 6, 0, 0x23B1}, {11765, 10, 0, 0x23B1}, {11775, 5, 0, 0x2AEE},
+    {11780, 5, 0, 0x27ED}, {11785, 5, 0, 0x21FE}, {11790, 5, 0, 0x27E7}, {11795, 5, 0, 0x2986},
+    {11800, 4, 0, 0x1D563}, {11804, 6, 0, 0x2A2E}, {11810, 7, 0, 0x2A35}, {11817, 4, 0, 0x29},
+    {11821, 6, 0, 0x2994}, {11827, 8, 0, 0x2A12}, {11835, 5, 0, 0x21C9}, {11840, 6, 0, 0x203A},
+    {11846, 4, 0, 0x1D4C7}, {11850, 3, 0, 0x21B1}, {11853, 4, 0, 0x5D}, {11857, 5, 0, 0x2019},
+    {11862, 6, 0, 0x2019}, {11868, 6, 0, 0x22CC}, {11874, 6, 0, 0x22CA}, {11880, 4, 0, 0x25B9},
+    {11884, 5, 0, 0x22B5}, {11889, 5, 0, 0x25B8}, {11894, 8, 0, 0x29CE}, {11902, 7, 0, 0x2968},
+    {11909, 2, 0, 0x211E}, {11911, 6, 0, 0x15B}, {11917, 5, 0, 0x201A}, {11922, 2, 0, 0x227B},
+    {11924, 3, 0, 0x2AB4}, {11927, 4, 0, 0x2AB8}, {11931, 6, 0, 0x161}, {11937, 5, 0, 0x227D},
+    {11942, 3, 0, 0x2AB0}, {11945, 6, 0, 0x15F}, {11951, 5, 0, 0x15D}, {11956, 4, 0, 0x2AB6},
+    {11960, 5, 0, 0x2ABA}, {11965, 6, 0, 0x22E9}, {11971, 8, 0, 0x2A13}, {11979, 5, 0, 0x227F},
+    {11984, 3, 0, 0x441}, {11987, 4, 0, 0x22C5}, {11991, 5, 0, 0x22A1}, {11996, 5, 0, 0x2A66},
+    {12001, 5, 0, 0x21D8}, {12006, 6, 0, 0x2925}, {12012, 5, 0, 0x2198}, {12017, 7, 0, 0x2198},
+    {12024, 4, 0, 0xA7}, {12028, 4, 0, 0x3B}, {12032, 6, 0, 0x2929}, {12038, 8, 0, 0x2216},
+    {12046, 5, 0, 0x2216}, {12051, 4, 0, 0x2736}, {12055, 3, 0, 0x1D530}, {12058, 6, 0, 0x2322},
+    {12064, 5, 0, 0x266F}, {12069, 6, 0, 0x449}, {12075, 4, 0, 0x448}, {12079, 8, 0, 0x2223},
+    {12087, 13, 0, 0x2225}, {12100, 3, 0, 0xAD}, {12103, 5, 0, 0x3C3}, {12108, 6, 0, 0x3C2},
+    {12114, 6, 0, 0x3C2}, {12120, 3, 0, 0x223C}, {12123, 6, 0, 0x2A6A}, {12129, 4, 0, 0x2243},
+    {12133, 5, 0, 0x2243}, {12138, 4, 0, 0x2A9E}, {12142, 5, 0, 0x2AA0}, {12147, 4, 0, 0x2A9D},
+    {12151, 5, 0, 0x2A9F}, {12156, 5, 0, 0x2246}, {12161, 7, 0, 0x2A24}, {12168, 7, 0, 0x2972},
+    {12175, 5, 0, 0x2190}, {12180, 13, 0, 0x2216}, {12193, 6, 0, 0x2A33}, {12199, 8, 0, 0x29E4},
+    {12207, 4, 0, 0x2223}, {12211, 5, 0, 0x2323}, {12216, 3, 0, 0x2AAA}, {12219, 4, 0, 0x2AAC},
+    {12223, 5, 8, 0x2AAC}, {12228, 6, 0, 0x44C}, {12234, 3, 0, 0x2F}, {12237, 4, 0, 0x29C4},
+    {12241, 6, 0, 0x233F}, {12247, 4, 0, 0x1D564}, {12251, 6, 0, 0x2660}, {12257, 9, 0, 0x2660},
+    {12266, 4, 0, 0x2225}, {12270, 5, 0, 0x2293}, {12275, 6, 8, 0x2293}, {12281, 5, 0, 0x2294},
+    {12286, 6, 8, 0x2294}, {12292, 5, 0, 0x228F}, {12297, 6, 0, 0x2291}, {12303, 8, 0, 0x228F},
+    {12311, 10, 0, 0x2291}, {12321, 5, 0, 0x2290}, {12326, 6, 0, 0x2292}, {12332, 8, 0, 0x2290},
+    {12340, 10, 0, 0x2292}, {12350, 3, 0, 0x25A1}, {12353, 6, 0, 0x25A1}, {12359, 6, 0, 0x25AA},
+    {12365, 4, 0, 0x25AA}, {12369, 5, 0, 0x2192}, {12374, 4, 0, 0x1D4C8}, {12378, 6, 0, 0x2216},
+    {12384, 6, 0, 0x2323}, {12390, 6, 0, 0x22C6}, {12396, 4, 0, 0x2606}, {12400, 5, 0, 0x2605},
+    {12405, 15, 0, 0x3F5}, {12420, 11, 0, 0x3D5}, {12431, 5, 0, 0xAF}, {12436, 3, 0, 0x2282},
+    {12439, 4, 0, 0x2AC5}, {12443, 6, 0, 0x2ABD}, {12449, 4, 0, 0x2286}, {12453, 7, 0, 0x2AC3},
+    {12460, 7, 0, 0x2AC1}, {12467, 5, 0, 0x2ACB}, {12472, 5, 0, 0x228A}, {12477, 7, 0, 0x2ABF},
+    {12484, 7, 0, 0x2979}, {12491, 6, 0, 0x2282}, {12497, 8, 0, 0x2286}, {12505, 9, 0, 0x2AC5},
+    {12514, 9, 0, 0x228A}, {12523, 10, 0, 0x2ACB}, {12533, 6, 0, 0x2AC7}, {12539, 6, 0, 0x2AD5},
+    {12545, 6, 0, 0x2AD3}, {12551, 4, 0, 0x227B}, {12555, 10, 0, 0x2AB8}, {12565, 11, 0, 0x227D},
+    {12576, 6, 0, 0x2AB0}, {12582, 11, 0, 0x2ABA}, {12593, 8, 0, 0x2AB6}, {12601, 8, 0, 0x22E9},
+    {12609, 7, 0, 0x227F}, {12616, 3, 0, 0x2211}, {12619, 4, 0, 0x266A}, {12623, 3, 0, 0x2283},
+    {12626, 4, 0, 0xB9}, {12630, 4, 0, 0xB2}, {12634, 4, 0, 0xB3}, {12638, 4, 0, 0x2AC6},
+    {12642, 6, 0, 0x2ABE}, {12648, 7, 0, 0x2AD8}, {12655, 4, 0, 0x2287}, {12659, 7, 0, 0x2AC4},
+    {12666, 7, 0, 0x27C9}, {12673, 7, 0, 0x2AD7}, {12680, 7, 0, 0x297B}, {12687, 7, 0, 0x2AC2},
+    {12694, 5, 0, 0x2ACC}, {12699, 5, 0, 0x228B}, {12704, 7, 0, 0x2AC0}, {12711, 6, 0, 0x2283},
+    {12717, 8, 0, 0x2287}, {12725, 9, 0, 0x2AC6}, {12734, 9, 0, 0x228B}, {12743, 10, 0, 0x2ACC},
+    {12753, 6, 0, 0x2AC8}, {12759, 6, 0, 0x2AD4}, {12765, 6, 0, 0x2AD6}, {12771, 5, 0, 0x21D9},
+    {12776, 6, 0, 0x2926}, {12782, 5, 0, 0x2199}, {12787, 7, 0, 0x2199}, {12794, 6, 0, 0x292A},
+    {12800, 5, 0, 0xDF}, {12805, 6, 0, 0x2316}, {12811, 3, 0, 0x3C4}, {12814, 4, 0, 0x23B4},
+    {12818, 6, 0, 0x165}, {12824, 6, 0, 0x163}, {12830, 3, 0, 0x442}, {12833, 4, 0, 0x20DB},
+    {12837, 6, 0, 0x2315}, {12843, 3, 0, 0x1D531}, {12846, 6, 0, 0x2234}, {12852, 9, 0, 0x2234},
+    {12861, 5, 0, 0x3B8}, {12866, 8, 0, 0x3D1}, {12874, 6, 0, 0x3D1}, {12880, 11, 0, 0x2248},
+    {12891, 8, 0, 0x223C}, {12899, 6, 0, 0x2009}, {12905, 5, 0, 0x2248}, {12910, 6, 0, 0x223C},
+    {12916, 5, 0, 0xFE}, {12921, 5, 0, 0x2DC}, {12926, 5, 0, 0xD7}, {12931, 6, 0, 0x22A0},
+    {12937, 8, 0, 0x2A31}, {12945, 6, 0, 0x2A30}, {12951, 4, 0, 0x222D}, {12955, 4, 0, 0x2928},
+    {12959, 3, 0, 0x22A4}, {12962, 6, 0, 0x2336}, {12968, 6, 0, 0x2AF1}, {12974, 4, 0, 0x1D565},
+    {12978, 7, 0, 0x2ADA}, {12985, 4, 0, 0x2929}, {12989, 6, 0, 0x2034}, {12995, 5, 0, 0x2122},
+    {13000, 8, 0, 0x25B5}, {13008, 12, 0, 0x25BF}, {13020, 12, 0, 0x25C3}, {13032, 14, 0, 0x22B4},
+    {13046, 9, 0, 0x225C}, {13055, 13, 0, 0x25B9}, {13068, 15, 0, 0x22B5}, {13083, 6, 0, 0x25EC},
+    {13089, 4, 0, 0x225C}, {13093, 8, 0, 0x2A3A}, {13101, 7, 0, 0x2A39}, {13108, 5, 0, 0x29CD},
+    {13113, 7, 0, 0x2A3B}, {13120, 8, 0, 0x23E2}, {13128, 4, 0, 0x1D4C9}, {13132, 4, 0, 0x446},
+    {13136, 5, 0, 0x45B}, {13141, 6, 0, 0x167}, {13147, 5, 0, 0x226C}, {13152, 16, 0, 0x219E},
+    {13168, 17, 0, 0x21A0}, {13185, 4, 0, 0x21D1}, {13189, 4, 0, 0x2963}, {13193, 6, 0, 0xFA},
+    {13199, 4, 0, 0x2191}, {13203, 5, 0, 0x45E}, {13208, 6, 0, 0x16D}, {13214, 5, 0, 0xFB},
+    {13219, 3, 0, 0x443}, {13222, 5, 0, 0x21C5}, {13227, 6, 0, 0x171}, {13233, 5, 0, 0x296E},
+    {13238, 6, 0, 0x297E}, {13244, 3, 0, 0x1D532}, {13247, 6, 0, 0xF9}, {13253, 5, 0, 0x21BF},
+    {13258, 5, 0, 0x21BE}, {13263, 5, 0, 0x2580}, {13268, 6, 0, 0x231C}, {13274, 8, 0, 0x231C},
+    {13282, 6, 0, 0x230F}, {13288, 5, 0, 0x25F8}, {13293, 5, 0, 0x16B}, {13298, 3, 0, 0xA8},
+    {13301, 5, 0, 0x173}, {13306, 4, 0, 0x1D566}, {13310, 7, 0, 0x2191}, {13317, 11, 0, 0x2195},
+    {13328, 13, 0, 0x21BF}, {13341, 14, 0, 0x21BE}, {13355, 5, 0, 0x228E}, {13360, 4, 0, 0x3C5},
+    {13364, 5, 0, 0x3D2}, {13369, 7, 0, 0x3C5}, {13376, 10, 0, 0x21C8}, {13386, 6, 0, 0x231D},
+    {13392, 8, 0, 0x231D}, {13400, 6, 0, 0x230E}, {13406, 5, 0, 0x16F}, {13411, 5, 0, 0x25F9},
+    {13416, 4, 0, 0x1D4CA}, {13420, 5, 0, 0x22F0}, {13425, 6, 0, 0x169}, {13431, 4, 0, 0x25B5},
+    {13435, 5, 0, 0x25B4}, {13440, 5, 0, 0x21C8}, {13445, 4, 0, 0xFC}, {13449, 7, 0, 0x29A7},
+    {13456, 4, 0, 0x21D5}, {13460, 4, 0, 0x2AE8}, {13464, 5, 0, 0x2AE9}, {13469, 5, 0, 0x22A8},
+    {13474, 6, 0, 0x299C}, {13480, 10, 0, 0x3F5}, {13490, 8, 0, 0x3F0}, {13498, 10, 0, 0x2205},
+    {13508, 6, 0, 0x3D5}, {13514, 5, 0, 0x3D6}, {13519, 9, 0, 0x221D}, {13528, 4, 0, 0x2195},
+    {13532, 6, 0, 0x3F1}, {13538, 8, 0, 0x3C2}, {13546, 12, 8, 0x228A}, {13558, 13, 8, 0x2ACB},
+    {13571, 12, 8, 0x228B}, {13583, 13, 8, 0x2ACC}, {13596, 8, 0, 0x3D1}, {13604, 15, 0, 0x22B2},
+    {13619, 16, 0, 0x22B3}, {13635, 3, 0, 0x432}, {13638, 5, 0, 0x22A2}, {13643, 3, 0, 0x2228},
+    {13646, 6, 0, 0x22BB}, {13652, 5, 0, 0x225A}, {13657, 6, 0, 0x22EE}, {13663, 6, 0, 0x7C},
+    {13669, 4, 0, 0x7C}, {13673, 3, 0, 0x1D533}, {13676, 5, 0, 0x22B2}, {13681, 5, 6, 0x2282},
+    {13686, 5, 6, 0x2283}, {13691, 4, 0, 0x1D567}, {13695, 5, 0, 0x221D}, {13700, 5, 0, 0x22B3},
+    {13705, 4, 0, 0x1D4CB}, {13709, 6, 8, 0x2ACB}, {13715, 6, 8, 0x228A}, {13721, 6, 8, 0x2ACC},
+    {13727, 6, 8, 0x228B}, {13733, 7, 0, 0x299A}, {13740, 5, 0, 0x175}, {13745, 6, 0, 0x2A5F},
+    {13751, 5, 0, 0x2227}, {13756, 6, 0, 0x2259}, {13762, 6, 0, 0x2118}, {13768, 3, 0, 0x1D534},
+    {13771, 4, 0, 0x1D568}, {13775, 2, 0, 0x2118}, {13777, 2, 0, 0x2240}, {13779, 6, 0, 0x2240},
+    {13785, 4, 0, 0x1D4CC}, {13789, 4, 0, 0x22C2}, {13793, 5, 0, 0x25EF}, {13798, 4, 0, 0x22C3},
+    {13802, 5, 0, 0x25BD}, {13807, 3, 0, 0x1D535}, {13810, 5, 0, 0x27FA}, {13815, 5, 0, 0x27F7},
+    {13820, 2, 0, 0x3BE}, {13822, 5, 0, 0x27F8}, {13827, 5, 0, 0x27F5}, {13832, 4, 0, 0x27FC},
+    {13836, 4, 0, 0x22FB}, {13840, 5, 0, 0x2A00}, {13845, 4, 0, 0x1D569}, {13849, 6, 0, 0x2A01},
+    {13855, 6, 0, 0x2A02}, {13861, 5, 0, 0x27F9}, {13866, 5, 0, 0x27F6}, {13871, 4, 0, 0x1D4CD},
+    {13875, 6, 0, 0x2A06}, {13881, 6, 0, 0x2A04}, {13887, 5, 0, 0x25B3}, {13892, 4, 0, 0x22C1},
+    {13896, 6, 0, 0x22C0}, {13902, 6, 0, 0xFD}, {13908, 4, 0, 0x44F}, {13912, 5, 0, 0x177},
+    {13917, 3, 0, 0x44B}, {13920, 3, 0, 0xA5}, {13923, 3, 0, 0x1D536}, {13926, 4, 0, 0x457},
+    {13930, 4, 0, 0x1D56A}, {13934, 4, 0, 0x1D4CE}, {13938, 4, 0, 0x44E}, {13942, 4, 0, 0xFF},
+    {13946, 6, 0, 0x17A}, {13952, 6, 0, 0x17E}, {13958, 3, 0, 0x437}, {13961, 4, 0, 0x17C},
+    {13965, 6, 0, 0x2128}, {13971, 4, 0, 0x3B6}, {13975, 3, 0, 0x1D537}, {13978, 4, 0, 0x436},
+    {13982, 7, 0, 0x21DD}, {13989, 4, 0, 0x1D56B}, {13993, 4, 0, 0x1D4CF}, {13997, 3, 0, 0x200D},
+    {14000, 4, 0, 0x200C},
+};
+
+// The shortest name of every character that has one, sorted by codepoint
+inline constexpr EntityShortestName shortest_entity_names[] = {
+    {0x9, 498}, {0xA, 304}, {0x21, 989}, {0x22, 1666}, {0x23, 1516}, {0x24, 903},
+    {0x25, 1598}, {0x26, 615}, {0x27, 646}, {0x28, 1302}, {0x29, 1751}, {0x2A, 651},
+    {0x2B, 1614}, {0x2C, 819}, {0x2E, 1599}, {0x2F, 1830}, {0x3A, 816}, {0x3B, 1793},
+    {0x3C, 1320}, {0x3D, 975}, {0x3E, 1073}, {0x3F, 1664}, {0x40, 820}, {0x5B, 1316},
+    {0x5C, 764}, {0x5D, 1758}, {0x5E, 175}, {0x5F, 1298}, {0x60, 1068}, {0x7B, 1223},
+    {0x7C, 2052}, {0x7D, 1706}, {0xA0, 1395}, {0xA1, 1121}, {0xA2, 792}, {0xA3, 1627},
+    {0xA4, 859}, {0xA5, 2105}, {0xA6, 759}, {0xA7, 1792}, {0xA8, 893}, {0xA9, 830},
+    {0xAA, 1577}, {0xAB, 1199}, {0xAC, 1453}, {0xAD, 1805}, {0xAE, 1718}, {0xAF, 1337},
+    {0xB0, 882}, {0xB1, 1624}, {0xB2, 1893}, {0xB3, 1894}, {0xB4, 604}, {0xB5, 1353},
+    {0xB6, 1592}, {0xB7, 1357}, {0xB8, 790}, {0xB9, 1892}, {0xBA, 1578}, {0xBB, 1680},
+    {0xBC, 1013}, {0xBD, 1090}, {0xBE, 1019}, {0xBF, 1154}, {0xC0, 7}, {0xC1, 2},
+    {0xC2, 4}, {0xC3, 17}, {0xC4, 18}, {0xC5, 637}, {0xC6, 0}, {0xC7, 38},
+    {0xC8, 127}, {0xC9, 121}, {0xCA, 123}, {0xCB, 141}, {0xCC, 193}, {0xCD, 188},
+    {0xCE, 189}, {0xCF, 209}, {0xD0, 120}, {0xD1, 362}, {0xD2, 370}, {0xD3, 365},
+    {0xD4, 366}, {0xD5, 380}, {0xD6, 382}, {0xD7, 1942}, {0xD8, 379}, {0xD9, 525},
+    {0xDA, 516}, {0xDB, 521}, {0xDC, 551}, {0xDD, 581}, {0xDE, 494}, {0xDF, 1920},
+    {0xE0, 609}, {0xE1, 598}, {0xE2, 603}, {0xE3, 654}, {0xE4, 655}, {0xE5, 649},
+    {0xE6, 606}, {0xE7, 785}, {0xE8, 945}, {0xE9, 933}, {0xEA, 937}, {0xEB, 987},
+    {0xEC, 1124}, {0xED, 1116}, {0xEE, 1118}, {0xEF, 1165}, {0xF0, 986}, {0xF1, 1509},
+    {0xF2, 1553}, {0xF3, 1539}, {0xF4, 1542}, {0xF5, 1586}, {0xF6, 1589}, {0xF7, 896},
+    {0xF8, 1584}, {0xF9, 1990}, {0xFA, 1979}, {0xFB, 1983}, {0xFC, 2022}, {0xFD, 2101},
+    {0xFE, 1940}, {0xFF, 2111}, {0x100, 9}, {0x101, 613}, {0x102, 3}, {0x103, 599},
+    {0x104, 11}, {0x105, 639}, {0x106, 33}, {0x107, 773}, {0x108, 39}, {0x109, 786},
+    {0x10A, 41}, {0x10B, 789}, {0x10C, 37}, {0x10D, 784}, {0x10E, 73}, {0x10F, 876},
+    {0x110, 118}, {0x111, 922}, {0x112, 129}, {0x113, 953}, {0x116, 125}, {0x117, 940},
+    {0x118, 132}, {0x119, 962}, {0x11A, 122}, {0x11B, 935}, {0x11C, 158}, {0x11D, 1036},
+    {0x11E, 156}, {0x11F, 1035}, {0x120, 160}, {0x121, 1038}, {0x122, 157}, {0x124, 176},
+    {0x125, 1097}, {0x126, 182}, {0x127, 1113}, {0x128, 207}, {0x129, 1163}, {0x12A, 195},
+    {0x12B, 1131}, {0x12E, 203}, {0x12F, 1150}, {0x130, 191}, {0x131, 1135}, {0x132, 186},
+    {0x133, 1130}, {0x134, 210}, {0x135, 1166}, {0x136, 220}, {0x137, 1176}, {0x138, 1179},
+    {0x139, 227}, {0x13A, 1191}, {0x13B, 233}, {0x13C, 1221}, {0x13D, 232}, {0x13E, 1220},
+    {0x13F, 270}, {0x140, 1274}, {0x141, 282}, {0x142, 1319}, {0x143, 294}, {0x144, 1385},
+    {0x145, 296}, {0x146, 1400}, {0x147, 295}, {0x148, 1399}, {0x149, 1390}, {0x14A, 119},
+    {0x14B, 960}, {0x14C, 371}, {0x14D, 1563}, {0x150, 368}, {0x151, 1545}, {0x152, 364},
+    {0x153, 1549}, {0x154, 412}, {0x155, 1673}, {0x156, 417}, {0x157, 1704}, {0x158, 416},
+    {0x159, 1703}, {0x15A, 457}, {0x15B, 1769}, {0x15C, 461}, {0x15D, 1778}, {0x15E, 460},
+    {0x15F, 1777}, {0x160, 459}, {0x161, 1774}, {0x162, 501}, {0x163, 1925}, {0x164, 500},
+    {0x165, 1924}, {0x166, 515}, {0x167, 1973}, {0x168, 550}, {0x169, 2018}, {0x16A, 526},
+    {0x16B, 1998}, {0x16C, 520}, {0x16D, 1982}, {0x16E, 548}, {0x16F, 2014}, {0x170, 523},
+    {0x171, 1986}, {0x172, 533}, {0x173, 2000}, {0x174, 569}, {0x175, 2066}, {0x176, 582},
+    {0x177, 2103}, {0x178, 587}, {0x179, 589}, {0x17A, 2112}, {0x17B, 592}, {0x17C, 2115},
+    {0x17D, 590}, {0x17E, 2113}, {0x192, 1005}, {0x1B5, 1137}, {0x1F5, 1031}, {0x237, 1169},
+    {0x2C6, 801}, {0x2C7, 782}, {0x2D8, 758}, {0x2D9, 905}, {0x2DA, 1736}, {0x2DB, 1552},
+    {0x2DC, 1941}, {0x2DD, 875}, {0x311, 106}, {0x391, 8}, {0x392, 25}, {0x393, 154},
+    {0x394, 76}, {0x395, 134}, {0x396, 594}, {0x397, 140}, {0x398, 505}, {0x399, 205},
+    {0x39A, 219}, {0x39B, 228}, {0x39C, 292}, {0x39D, 363}, {0x39E, 575}, {0x39F, 373},
+    {0x3A0, 391}, {0x3A1, 424}, {0x3A3, 468}, {0x3A4, 499}, {0x3A5, 547}, {0x3A6, 390},
+    {0x3A7, 45}, {0x3A8, 405}, {0x3A9, 1556}, {0x3B1, 612}, {0x3B2, 677}, {0x3B3, 1032},
+    {0x3B4, 883}, {0x3B5, 967}, {0x3B6, 2117}, {0x3B7, 985}, {0x3B8, 1932}, {0x3B9, 1152},
+    {0x3BA, 1174}, {0x3BB, 1194}, {0x3BC, 1370}, {0x3BD, 1515}, {0x3BE, 2084}, {0x3BF, 1565},
+    {0x3C0, 1608}, {0x3C1, 1725}, {0x3C2, 1807}, {0x3C3, 1806}, {0x3C4, 1922}, {0x3C5, 2007},
+    {0x3C6, 1604}, {0x3C7, 798}, {0x3C8, 1655}, {0x3C9, 1564}, {0x3D1, 1934}, {0x3D2, 546},
+    {0x3D5, 1605}, {0x3D6, 1610}, {0x3DC, 155}, {0x3DD, 1033}, {0x3F0, 1175}, {0x3F1, 1726},
+    {0x3F5, 969}, {0x3F6, 675}, {0x401, 187}, {0x402, 67}, {0x403, 152}, {0x404, 216},
+    {0x405, 68}, {0x406, 208}, {0x407, 579}, {0x408, 215}, {0x409, 225}, {0x40A, 293},
+    {0x40B, 496}, {0x40C, 218}, {0x40E, 519}, {0x40F, 69}, {0x410, 5}, {0x411, 22},
+    {0x412, 554}, {0x413, 159}, {0x414, 74}, {0x415, 185}, {0x416, 588}, {0x417, 591},
+    {0x418, 190}, {0x419, 211}, {0x41A, 221}, {0x41B, 234}, {0x41C, 285}, {0x41D, 297},
+    {0x41E, 367}, {0x41F, 388}, {0x420, 418}, {0x421, 462}, {0x422, 502}, {0x423, 522},
+    {0x424, 144}, {0x425, 217}, {0x426, 497}, {0x427, 31}, {0x428, 455}, {0x429, 454},
+    {0x42A, 173}, {0x42B, 583}, {0x42C, 456}, {0x42D, 124}, {0x42E, 580}, {0x42F, 578},
+    {0x430, 605}, {0x431, 670}, {0x432, 2045}, {0x433, 1037}, {0x434, 877}, {0x435, 1120},
+    {0x436, 2119}, {0x437, 2114}, {0x438, 1119}, {0x439, 1167}, {0x43A, 1177}, {0x43B, 1224},
+    {0x43C, 1348}, {0x43D, 1404}, {0x43E, 1543}, {0x43F, 1597}, {0x440, 1707}, {0x441, 1784},
+    {0x442, 1926}, {0x443, 1984}, {0x444, 994}, {0x445, 1180}, {0x446, 1971}, {0x447, 795},
+    {0x448, 1802}, {0x449, 1801}, {0x44A, 1092}, {0x44B, 2104}, {0x44C, 1829}, {0x44D, 939},
+    {0x44E, 2110}, {0x44F, 2102}, {0x451, 1149}, {0x452, 900}, {0x453, 1055}, {0x454, 1173},
+    {0x455, 920}, {0x456, 1164}, {0x457, 2107}, {0x458, 1172}, {0x459, 1268}, {0x45A, 1434},
+    {0x45B, 1972}, {0x45C, 1181}, {0x45E, 1981}, {0x45F, 929}, {0x2002, 961}, {0x2003, 957},
+    {0x2004, 958}, {0x2005, 959}, {0x2007, 1518}, {0x2008, 1656}, {0x2009, 1937}, {0x200A, 1089},
+    {0x200B, 593}, {0x200C, 2124}, {0x200D, 2123}, {0x200E, 1308}, {0x200F, 1740}, {0x2010, 872},
+    {0x2013, 1405}, {0x2014, 1349}, {0x2015, 1110}, {0x2016, 559}, {0x2018, 1317}, {0x2019, 1759},
+    {0x201A, 1770}, {0x201C, 1226}, {0x201D, 1710}, {0x201E, 671}, {0x2020, 869}, {0x2021, 70},
+    {0x2022, 767}, {0x2025, 1438}, {0x2026, 1363}, {0x2030, 1600}, {0x2031, 1602}, {0x2032, 1641},
+    {0x2033, 400}, {0x2034, 1954}, {0x2035, 757}, {0x2039, 1310}, {0x203A, 1755}, {0x203E, 1561},
+    {0x2041, 781}, {0x2043, 1114}, {0x2044, 1026}, {0x204F, 761}, {0x2057, 1660}, {0x205F, 286},
+    {0x2060, 306}, {0x2061, 607}, {0x2062, 1162}, {0x2063, 1117}, {0x20AC, 988}, {0x20DB, 1927},
+    {0x20DC, 87}, {0x2102, 58}, {0x2105, 1139}, {0x210A, 1069}, {0x210B, 181}, {0x210C, 177},
+    {0x210D, 179}, {0x210E, 1612}, {0x210F, 1096}, {0x2110, 206}, {0x2111, 194}, {0x2112, 280},
+    {0x2113, 950}, {0x2115, 308}, {0x2116, 1517}, {0x2117, 831}, {0x2118, 2073}, {0x2119, 394},
+    {0x211A, 408}, {0x211B, 451}, {0x211C, 419}, {0x211D, 448}, {0x211E, 1768}, {0x2122, 1955},
+    {0x2124, 596}, {0x2127, 1352}, {0x2128, 595}, {0x2129, 1129}, {0x212C, 29}, {0x212D, 44},
+    {0x212F, 982}, {0x2130, 138}, {0x2131, 151}, {0x2133, 291}, {0x2134, 1583}, {0x2135, 611},
+    {0x2136, 678}, {0x2137, 1054}, {0x2138, 870}, {0x2145, 65}, {0x2146, 878}, {0x2147, 941},
+    {0x2148, 1125}, {0x2153, 1012}, {0x2154, 1017}, {0x2155, 1014}, {0x2156, 1018}, {0x2157, 1020},
+    {0x2158, 1022}, {0x2159, 1015}, {0x215A, 1023}, {0x215B, 1016}, {0x215C, 1021}, {0x215D, 1024},
+    {0x215E, 1025}, {0x2190, 1200}, {0x2191, 1980}, {0x2192, 1681}, {0x2193, 871}, {0x2194, 1093},
+    {0x2195, 2035}, {0x2196, 1535}, {0x2197, 1409}, {0x2198, 1790}, {0x2199, 1917}, {0x219A, 1437},
+    {0x219B, 1475}, {0x219D, 1692}, {0x219E, 231}, {0x219F, 517}, {0x21A0, 414}, {0x21A1, 71},
+    {0x21A2, 1208}, {0x21A3, 1691}, {0x21A4, 1344}, {0x21A5, 1345}, {0x21A6, 1341}, {0x21A7, 1343},
+    {0x21A9, 1204}, {0x21AA, 1687}, {0x21AB, 1205}, {0x21AC, 1688}, {0x21AD, 1095}, {0x21AE, 1428},
+    {0x21B0, 1312}, {0x21B1, 1757}, {0x21B2, 1230}, {0x21B3, 1712}, {0x21B5, 832}, {0x21B6, 844},
+    {0x21B7, 853}, {0x21BA, 1558}, {0x21BB, 1573}, {0x21BC, 1265}, {0x21BD, 1264}, {0x21BE, 1992},
+    {0x21BF, 1991}, {0x21C0, 1723}, {0x21C1, 1722}, {0x21C2, 888}, {0x21C3, 887}, {0x21C4, 1738},
+    {0x21C5, 1985}, {0x21C6, 1304}, {0x21C7, 1270}, {0x21C8, 2021}, {0x21C9, 1754}, {0x21CA, 880},
+    {0x21CB, 1306}, {0x21CC, 1739}, {0x21CD, 1435}, {0x21CE, 1427}, {0x21CF, 1474}, {0x21D0, 1185},
+    {0x21D1, 1977}, {0x21D2, 1668}, {0x21D3, 867}, {0x21D4, 1122}, {0x21D5, 2024}, {0x21D6, 1533},
+    {0x21D7, 1407}, {0x21D8, 1788}, {0x21D9, 1915}, {0x21DA, 1184}, {0x21DB, 1667}, {0x21DD, 2120},
+    {0x21E4, 1201}, {0x21E5, 1683}, {0x21F5, 926}, {0x21FD, 1285}, {0x21FE, 1745}, {0x21FF, 1105},
+    {0x2200, 1007}, {0x2201, 821}, {0x2202, 1596}, {0x2203, 990}, {0x2204, 1415}, {0x2205, 954},
+    {0x2207, 75}, {0x2208, 1138}, {0x2209, 1454}, {0x220B, 1430}, {0x220C, 1460}, {0x220F, 1646},
+    {0x2210, 829}, {0x2211, 1889}, {0x2212, 1358}, {0x2213, 1367}, {0x2214, 1618}, {0x2216, 1796},
+    {0x2217, 1297}, {0x2218, 822}, {0x221A, 471}, {0x221D, 1650}, {0x221E, 1140}, {0x221F, 633},
+    {0x2220, 621}, {0x2221, 624}, {0x2222, 636}, {0x2223, 1354}, {0x2224, 1451}, {0x2225, 1591},
+    {0x2226, 1464}, {0x2227, 616}, {0x2228, 1572}, {0x2229, 774}, {0x222A, 846}, {0x222B, 1143},
+    {0x222C, 198}, {0x222D, 1946}, {0x222E, 1557}, {0x222F, 56}, {0x2230, 40}, {0x2231, 865},
+    {0x2232, 864}, {0x2233, 656}, {0x2234, 1930}, {0x2235, 672}, {0x2236, 1694}, {0x2237, 53},
+    {0x2238, 1360}, {0x223A, 1336}, {0x223B, 1106}, {0x223C, 1809}, {0x223D, 762}, {0x223E, 600},
+    {0x223F, 602}, {0x2240, 2074}, {0x2241, 1487}, {0x2242, 984}, {0x2243, 1811}, {0x2244, 1488},
+    {0x2245, 825}, {0x2246, 1817}, {0x2247, 1401}, {0x2248, 641}, {0x2249, 1387}, {0x224A, 644},
+    {0x224B, 645}, {0x224C, 669}, {0x224D, 64}, {0x224E, 769}, {0x224F, 771}, {0x2250, 906},
+    {0x2251, 932}, {0x2252, 942}, {0x2253, 980}, {0x2254, 817}, {0x2255, 938}, {0x2256, 936},
+    {0x2257, 810}, {0x2259, 2069}, {0x225A, 2049}, {0x225C, 1964}, {0x225F, 976}, {0x2260, 1406},
+    {0x2261, 977}, {0x2262, 1412}, {0x2264, 1231}, {0x2265, 1039}, {0x2266, 1188}, {0x2267, 1029},
+    {0x2268, 1277}, {0x2269, 1060}, {0x226A, 1269}, {0x226B, 1052}, {0x226C, 1974}, {0x226D, 311},
+    {0x226E, 1448}, {0x226F, 1425}, {0x2270, 1439}, {0x2271, 1419}, {0x2272, 1313}, {0x2273, 1070},
+    {0x2274, 1447}, {0x2275, 1424}, {0x2276, 1262}, {0x2277, 1056}, {0x2278, 1510}, {0x2279, 1508},
+    {0x227A, 1628}, {0x227B, 1771}, {0x227C, 1631}, {0x227D, 1775}, {0x227E, 1652}, {0x227F, 1783},
+    {0x2280, 1469}, {0x2281, 1481}, {0x2282, 1863}, {0x2283, 1891}, {0x2284, 1494}, {0x2285, 1502},
+    {0x2286, 1866}, {0x2287, 1898}, {0x2288, 1496}, {0x2289, 1504}, {0x228A, 1870}, {0x228B, 1905},
+    {0x228D, 850}, {0x228E, 2006}, {0x228F, 1841}, {0x2290, 1845}, {0x2291, 1842}, {0x2292, 1846},
+    {0x2293, 1837}, {0x2294, 1839}, {0x2295, 1571}, {0x2296, 1567}, {0x2297, 1587}, {0x2298, 1585},
+    {0x2299, 1547}, {0x229A, 1541}, {0x229B, 1540}, {0x229D, 1544}, {0x229E, 1616}, {0x229F, 1359},
+    {0x22A0, 1943}, {0x22A1, 1786}, {0x22A2, 2046}, {0x22A3, 873}, {0x22A4, 1948}, {0x22A5, 710},
+    {0x22A7, 1365}, {0x22A8, 2027}, {0x22A9, 555}, {0x22AA, 568}, {0x22AB, 552}, {0x22AC, 1522},
+    {0x22AD, 1519}, {0x22AE, 1383}, {0x22AF, 1382}, {0x22B0, 1653}, {0x22B2, 2054}, {0x22B3, 2059},
+    {0x22B4, 1330}, {0x22B5, 1764}, {0x22B6, 1579}, {0x22B7, 1136}, {0x22B8, 1372}, {0x22B9, 1101},
+    {0x22BA, 1144}, {0x22BB, 2048}, {0x22BD, 664}, {0x22BE, 634}, {0x22BF, 1309}, {0x22C0, 570},
+    {0x22C1, 557}, {0x22C2, 2077}, {0x22C3, 2079}, {0x22C4, 889}, {0x22C5, 1785}, {0x22C6, 480},
+    {0x22C7, 899}, {0x22C8, 712}, {0x22C9, 1325}, {0x22CA, 1762}, {0x22CB, 1324}, {0x22CC, 1761},
+    {0x22CD, 763}, {0x22CE, 862}, {0x22CF, 863}, {0x22D0, 481}, {0x22D1, 490}, {0x22D2, 34},
+    {0x22D3, 63}, {0x22D4, 1008}, {0x22D5, 964}, {0x22D6, 1323}, {0x22D7, 1076}, {0x22D8, 268},
+    {0x22D9, 162}, {0x22DA, 1242}, {0x22DB, 1040}, {0x22DE, 842}, {0x22DF, 843}, {0x22E0, 1470},
+    {0x22E1, 1482}, {0x22E2, 1492}, {0x22E3, 1493}, {0x22E6, 1283}, {0x22E7, 1066}, {0x22E8, 1645},
+    {0x22E9, 1781}, {0x22EA, 1449}, {0x22EB, 1479}, {0x22EC, 1450}, {0x22ED, 1480}, {0x22EE, 2050},
+    {0x22EF, 839}, {0x22F0, 2017}, {0x22F1, 923}, {0x22F2, 895}, {0x22F3, 1160}, {0x22F4, 1159},
+    {0x22F5, 1158}, {0x22F6, 1459}, {0x22F7, 1458}, {0x22F9, 1157}, {0x22FA, 1432}, {0x22FB, 2088},
+    {0x22FC, 1431}, {0x22FD, 1463}, {0x22FE, 1462}, {0x2305, 665}, {0x2306, 21}, {0x2308, 1222},
+    {0x2309, 1705}, {0x230A, 1260}, {0x230B, 1720}, {0x230C, 918}, {0x230D, 902}, {0x230E, 2013},
+    {0x230F, 1996}, {0x2310, 708}, {0x2312, 1648}, {0x2313, 1649}, {0x2315, 1928}, {0x2316, 1921},
+    {0x231C, 1994}, {0x231D, 2011}, {0x231E, 901}, {0x231F, 917}, {0x2322, 1027}, {0x2323, 1825},
+    {0x232D, 866}, {0x232E, 1647}, {0x2336, 1949}, {0x233D, 1590}, {0x233F, 1832}, {0x237C, 638},
+    {0x23B0, 1275}, {0x23B1, 1741}, {0x23B4, 1923}, {0x23B5, 667}, {0x23B6, 668}, {0x23DC, 386},
+    {0x23DD, 530}, {0x23DE, 384}, {0x23DF, 528}, {0x23E2, 1969}, {0x23E7, 949}, {0x2423, 701},
+    {0x24C8, 1538}, {0x2500, 738}, {0x2502, 750}, {0x250C, 737}, {0x2510, 736}, {0x2514, 749},
+    {0x2518, 748}, {0x251C, 756}, {0x2524, 755}, {0x252C, 741}, {0x2534, 742}, {0x253C, 754},
+    {0x2550, 717}, {0x2551, 726}, {0x2552, 735}, {0x2553, 716}, {0x2554, 714}, {0x2555, 734},
+    {0x2556, 715}, {0x2557, 713}, {0x2558, 747}, {0x2559, 725}, {0x255A, 723}, {0x255B, 746},
+    {0x255C, 724}, {0x255D, 722}, {0x255E, 753}, {0x255F, 732}, {0x2560, 729}, {0x2561, 752},
+    {0x2562, 731}, {0x2563, 728}, {0x2564, 720}, {0x2565, 739}, {0x2566, 718}, {0x2567, 721},
+    {0x2568, 740}, {0x2569, 719}, {0x256A, 751}, {0x256B, 730}, {0x256C, 727}, {0x2580, 1993},
+    {0x2584, 1267}, {0x2588, 705}, {0x2591, 703}, {0x2592, 702}, {0x2593, 704}, {0x25A1, 1849},
+    {0x25AA, 1852}, {0x25AB, 131}, {0x25AD, 1717}, {0x25AE, 1346}, {0x25B1, 1004}, {0x25B3, 2098},
+    {0x25B4, 2020}, {0x25B5, 2019}, {0x25B8, 1765}, {0x25B9, 1763}, {0x25BD, 2080}, {0x25BE, 925},
+    {0x25BF, 924}, {0x25C2, 1331}, {0x25C3, 1329}, {0x25CA, 1299}, {0x25CB, 799}, {0x25EC, 1963},
+    {0x25EF, 2078}, {0x25F8, 1997}, {0x25F9, 2015}, {0x25FA, 1273}, {0x25FB, 130}, {0x25FC, 146},
+    {0x2605, 1859}, {0x2606, 1858}, {0x260E, 1607}, {0x2640, 995}, {0x2642, 1338}, {0x2660, 1834},
+    {0x2663, 814}, {0x2665, 1098}, {0x2666, 892}, {0x266A, 1890}, {0x266D, 1002}, {0x266E, 1392},
+    {0x266F, 1800}, {0x2713, 796}, {0x2717, 833}, {0x2720, 1339}, {0x2736, 1797}, {0x2758, 562},
+    {0x2772, 1214}, {0x2773, 1697}, {0x27C8, 766}, {0x27C9, 1900}, {0x27E6, 1286}, {0x27E7, 1746},
+    {0x27E8, 1195}, {0x27E9, 1676}, {0x27EA, 229}, {0x27EB, 413}, {0x27EC, 1284}, {0x27ED, 1744},
+    {0x27F5, 2086}, {0x27F6, 2094}, {0x27F7, 2083}, {0x27F8, 2085}, {0x27F9, 2093}, {0x27FA, 2082},
+    {0x27FC, 2087}, {0x27FF, 930}, {0x2902, 1526}, {0x2903, 1530}, {0x2904, 1520}, {0x2905, 284},
+    {0x290C, 1213}, {0x290D, 1696}, {0x290E, 1187}, {0x290F, 1670}, {0x2910, 410}, {0x2911, 66},
+    {0x2912, 536}, {0x2913, 104}, {0x2916, 415}, {0x2919, 1210}, {0x291A, 1693}, {0x291B, 1186},
+    {0x291C, 1669}, {0x291D, 1203}, {0x291E, 1686}, {0x291F, 1202}, {0x2920, 1684}, {0x2923, 1534},
+    {0x2924, 1408}, {0x2925, 1789}, {0x2926, 1916}, {0x2927, 1537}, {0x2928, 1947}, {0x2929, 1953},
+    {0x292A, 1919}, {0x2933, 1685}, {0x2935, 841}, {0x2936, 1225}, {0x2937, 1708}, {0x2938, 840},
+    {0x2939, 1206}, {0x293C, 854}, {0x293D, 845}, {0x2945, 1689}, {0x2948, 1094}, {0x2949, 518},
+    {0x294A, 1332}, {0x294B, 1229}, {0x294E, 246}, {0x294F, 441}, {0x2950, 107}, {0x2951, 253},
+    {0x2952, 258}, {0x2953, 446}, {0x2954, 444}, {0x2955, 433}, {0x2956, 110}, {0x2957, 113},
+    {0x2958, 256}, {0x2959, 243}, {0x295A, 249}, {0x295B, 437}, {0x295C, 442}, {0x295D, 431},
+    {0x295E, 108}, {0x295F, 111}, {0x2960, 254}, {0x2961, 241}, {0x2962, 1190}, {0x2963, 1978},
+    {0x2964, 1671}, {0x2965, 868}, {0x2966, 1333}, {0x2967, 1228}, {0x2968, 1767}, {0x2969, 1709},
+    {0x296A, 1266}, {0x296B, 1272}, {0x296C, 1724}, {0x296D, 1307}, {0x296E, 1987}, {0x296F, 927},
+    {0x2970, 449}, {0x2971, 981}, {0x2972, 1819}, {0x2973, 1207}, {0x2974, 1690}, {0x2975, 1682},
+    {0x2976, 1326}, {0x2978, 1080}, {0x2979, 1872}, {0x297B, 1902}, {0x297C, 1259}, {0x297D, 1719},
+    {0x297E, 1988}, {0x297F, 885}, {0x2985, 1293}, {0x2986, 1747}, {0x298B, 1217}, {0x298C, 1700},
+    {0x298D, 1219}, {0x298E, 1701}, {0x298F, 1218}, {0x2990, 1702}, {0x2991, 1196}, {0x2992, 1677},
+    {0x2993, 1303}, {0x2994, 1752}, {0x2995, 1077}, {0x2996, 1328}, {0x299A, 2065}, {0x299C, 2028},
+    {0x299D, 635}, {0x29A4, 622}, {0x29A5, 1678}, {0x29A6, 928}, {0x29A7, 2023}, {0x29A8, 625},
+    {0x29A9, 626}, {0x29AA, 627}, {0x29AB, 628}, {0x29AC, 629}, {0x29AD, 630}, {0x29AE, 631},
+    {0x29AF, 632}, {0x29B0, 674}, {0x29B1, 884}, {0x29B2, 791}, {0x29B3, 1675}, {0x29B4, 1192},
+    {0x29B5, 1555}, {0x29B6, 1566}, {0x29B7, 1569}, {0x29B9, 1570}, {0x29BB, 1560}, {0x29BC, 1548},
+    {0x29BE, 1559}, {0x29BF, 1550}, {0x29C0, 1562}, {0x29C1, 1554}, {0x29C2, 813}, {0x29C3, 800},
+    {0x29C4, 1831}, {0x29C5, 765}, {0x29C9, 733}, {0x29CD, 1967}, {0x29CE, 1766}, {0x29CF, 251},
+    {0x29D0, 439}, {0x29DC, 1128}, {0x29DD, 1141}, {0x29DE, 1525}, {0x29E3, 965}, {0x29E4, 1823},
+    {0x29E5, 979}, {0x29EB, 1301}, {0x29F4, 453}, {0x29F6, 921}, {0x2A00, 2089}, {0x2A01, 2091},
+    {0x2A02, 2092}, {0x2A04, 2097}, {0x2A06, 2096}, {0x2A0C, 1658}, {0x2A0D, 1010}, {0x2A10, 811},
+    {0x2A11, 657}, {0x2A12, 1753}, {0x2A13, 1782}, {0x2A14, 1468}, {0x2A15, 1625}, {0x2A16, 1663},
+    {0x2A17, 1147}, {0x2A22, 1617}, {0x2A23, 1615}, {0x2A24, 1818}, {0x2A25, 1619}, {0x2A26, 1622},
+    {0x2A27, 1623}, {0x2A29, 1347}, {0x2A2A, 1361}, {0x2A2D, 1295}, {0x2A2E, 1749}, {0x2A2F, 61},
+    {0x2A30, 1945}, {0x2A31, 1944}, {0x2A33, 1822}, {0x2A34, 1296}, {0x2A35, 1750}, {0x2A36, 1588},
+    {0x2A37, 381}, {0x2A38, 1546}, {0x2A39, 1966}, {0x2A3A, 1965}, {0x2A3B, 1968}, {0x2A3C, 1153},
+    {0x2A3F, 614}, {0x2A40, 779}, {0x2A42, 1403}, {0x2A43, 1398}, {0x2A44, 775}, {0x2A45, 851},
+    {0x2A46, 848}, {0x2A47, 778}, {0x2A48, 847}, {0x2A49, 776}, {0x2A4A, 849}, {0x2A4B, 777},
+    {0x2A4C, 787}, {0x2A4D, 783}, {0x2A50, 788}, {0x2A53, 10}, {0x2A54, 377}, {0x2A55, 617},
+    {0x2A56, 1580}, {0x2A57, 1581}, {0x2A58, 619}, {0x2A5A, 620}, {0x2A5B, 1582}, {0x2A5C, 618},
+    {0x2A5D, 1574}, {0x2A5F, 2067}, {0x2A66, 1787}, {0x2A6A, 1810}, {0x2A6D, 826}, {0x2A6E, 934},
+    {0x2A6F, 643}, {0x2A70, 642}, {0x2A71, 966}, {0x2A72, 1620}, {0x2A73, 139}, {0x2A74, 54},
+    {0x2A75, 135}, {0x2A77, 931}, {0x2A78, 978}, {0x2A79, 1322}, {0x2A7A, 1075}, {0x2A7B, 1327},
+    {0x2A7C, 1078}, {0x2A7D, 1246}, {0x2A7E, 1044}, {0x2A7F, 1248}, {0x2A80, 1046}, {0x2A81, 1249},
+    {0x2A82, 1047}, {0x2A83, 1250}, {0x2A84, 1048}, {0x2A85, 1198}, {0x2A86, 1034}, {0x2A87, 1280},
+    {0x2A88, 1063}, {0x2A89, 1278}, {0x2A8A, 1061}, {0x2A8B, 1189}, {0x2A8C, 1030}, {0x2A8D, 1314},
+    {0x2A8E, 1071}, {0x2A8F, 1315}, {0x2A90, 1072}, {0x2A91, 1263}, {0x2A92, 1057}, {0x2A93, 1252},
+    {0x2A94, 1050}, {0x2A95, 951}, {0x2A96, 946}, {0x2A97, 952}, {0x2A98, 947}, {0x2A99, 948},
+    {0x2A9A, 944}, {0x2A9D, 1815}, {0x2A9E, 1813}, {0x2A9F, 1816}, {0x2AA0, 1814}, {0x2AA1, 264},
+    {0x2AA2, 167}, {0x2AA4, 1059}, {0x2AA5, 1058}, {0x2AA6, 1321}, {0x2AA7, 1074}, {0x2AA8, 1247},
+    {0x2AA9, 1045}, {0x2AAA, 1826}, {0x2AAB, 1209}, {0x2AAC, 1827}, {0x2AAD, 1211}, {0x2AAE, 770},
+    {0x2AAF, 1632}, {0x2AB0, 1776}, {0x2AB3, 1629}, {0x2AB4, 1772}, {0x2AB5, 1643}, {0x2AB6, 1779},
+    {0x2AB7, 1630}, {0x2AB8, 1773}, {0x2AB9, 1644}, {0x2ABA, 1780}, {0x2ABB, 395}, {0x2ABC, 458},
+    {0x2ABD, 1865}, {0x2ABE, 1896}, {0x2ABF, 1871}, {0x2AC0, 1906}, {0x2AC1, 1868}, {0x2AC2, 1903},
+    {0x2AC3, 1867}, {0x2AC4, 1899}, {0x2AC5, 1864}, {0x2AC6, 1895}, {0x2AC7, 1878}, {0x2AC8, 1912},
+    {0x2ACB, 1869}, {0x2ACC, 1904}, {0x2ACF, 835}, {0x2AD0, 837}, {0x2AD1, 836}, {0x2AD2, 838},
+    {0x2AD3, 1880}, {0x2AD4, 1913}, {0x2AD5, 1879}, {0x2AD6, 1914}, {0x2AD7, 1901}, {0x2AD8, 1897},
+    {0x2AD9, 1009}, {0x2ADA, 1952}, {0x2ADB, 1362}, {0x2AE4, 72}, {0x2AE6, 556}, {0x2AE7, 20},
+    {0x2AE8, 2025}, {0x2AE9, 2026}, {0x2AEB, 553}, {0x2AEC, 309}, {0x2AED, 658}, {0x2AEE, 1743},
+    {0x2AEF, 812}, {0x2AF0, 1356}, {0x2AF1, 1950}, {0x2AF2, 1429}, {0x2AF3, 1594}, {0x2AFD, 1595},
+    {0xFB00, 997}, {0xFB01, 1000}, {0xFB02, 1003}, {0xFB03, 996}, {0xFB04, 998}, {0x1D49C, 15},
+    {0x1D49E, 62}, {0x1D49F, 117}, {0x1D4A2, 171}, {0x1D4A5, 214}, {0x1D4A6, 224}, {0x1D4A9, 361},
+    {0x1D4AA, 378}, {0x1D4AB, 404}, {0x1D4AC, 409}, {0x1D4AE, 479}, {0x1D4AF, 514}, {0x1D4B0, 549},
+    {0x1D4B1, 567}, {0x1D4B2, 573}, {0x1D4B3, 577}, {0x1D4B4, 586}, {0x1D4B5, 597}, {0x1D4B6, 650},
+    {0x1D4B7, 760}, {0x1D4B8, 834}, {0x1D4B9, 919}, {0x1D4BB, 1028}, {0x1D4BD, 1111}, {0x1D4BE, 1155},
+    {0x1D4BF, 1171}, {0x1D4C0, 1183}, {0x1D4C1, 1311}, {0x1D4C2, 1368}, {0x1D4C3, 1484}, {0x1D4C5, 1654},
+    {0x1D4C6, 1661}, {0x1D4C7, 1756}, {0x1D4C8, 1854}, {0x1D4C9, 1970}, {0x1D4CA, 2016}, {0x1D4CB, 2060},
+    {0x1D4CC, 2076}, {0x1D4CD, 2095}, {0x1D4CE, 2109}, {0x1D4CF, 2122}, {0x1D504, 6}, {0x1D505, 26},
+    {0x1D507, 77}, {0x1D508, 126}, {0x1D509, 145}, {0x1D50A, 161}, {0x1D50D, 212}, {0x1D50E, 222},
+    {0x1D50F, 267}, {0x1D510, 288}, {0x1D511, 305}, {0x1D512, 369}, {0x1D513, 389}, {0x1D514, 407},
+    {0x1D516, 463}, {0x1D517, 503}, {0x1D518, 524}, {0x1D519, 565}, {0x1D51A, 571}, {0x1D51B, 574},
+    {0x1D51C, 584}, {0x1D51E, 608}, {0x1D51F, 680}, {0x1D520, 794}, {0x1D521, 886}, {0x1D522, 943},
+    {0x1D523, 999}, {0x1D524, 1051}, {0x1D525, 1102}, {0x1D526, 1123}, {0x1D527, 1168}, {0x1D528, 1178},
+    {0x1D529, 1261}, {0x1D52A, 1351}, {0x1D52B, 1417}, {0x1D52C, 1551}, {0x1D52D, 1603}, {0x1D52E, 1657},
+    {0x1D52F, 1721}, {0x1D530, 1798}, {0x1D531, 1929}, {0x1D532, 1989}, {0x1D533, 2053}, {0x1D534, 2071},
+    {0x1D535, 2081}, {0x1D536, 2106}, {0x1D537, 2118}, {0x1D538, 12}, {0x1D539, 27}, {0x1D53B, 85},
+    {0x1D53C, 133}, {0x1D53D, 148}, {0x1D53E, 163}, {0x1D540, 204}, {0x1D541, 213}, {0x1D542, 223},
+    {0x1D543, 277}, {0x1D544, 290}, {0x1D546, 374}, {0x1D54A, 470}, {0x1D54B, 512}, {0x1D54C, 534},
+    {0x1D54D, 566}, {0x1D54E, 572}, {0x1D54F, 576}, {0x1D550, 585}, {0x1D552, 640}, {0x1D553, 709},
+    {0x1D554, 828}, {0x1D555, 904}, {0x1D556, 963}, {0x1D557, 1006}, {0x1D558, 1067}, {0x1D559, 1109},
+    {0x1D55A, 1151}, {0x1D55B, 1170}, {0x1D55C, 1182}, {0x1D55D, 1294}, {0x1D55E, 1366}, {0x1D55F, 1452},
+    {0x1D560, 1568}, {0x1D561, 1626}, {0x1D562, 1659}, {0x1D563, 1748}, {0x1D564, 1833}, {0x1D565, 1951},
+    {0x1D566, 2001}, {0x1D567, 2057}, {0x1D568, 2072}, {0x1D569, 2090}, {0x1D56A, 2108}, {0x1D56B, 2121},
+};
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+struct Hash128
+{
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const Hash128&) const = default;
+};
+
+/**
+ * @brief 64x64 -> 128 bit multiply, folded back to 64 bits
+*/
+inline uint64_t multiply_fold(uint64_t a, uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = __uint128_t(a) * b;
+    return uint64_t(product) ^ uint64_t(product >> 64);
+#else
+    uint64_t a_low = a & 0xFFFFFFFF, a_high = a >> 32;
+    uint64_t b_low = b & 0xFFFFFFFF, b_high = b >> 32;
+    uint64_t low_low = a_low * b_low, low_high = a_low * b_high, high_low = a_high * b_low, high_high = a_high * b_high;
+    uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFF) + (high_low & 0xFFFFFFFF);
+    uint64_t low = (middle << 32) | (low_low & 0xFFFFFFFF);
+    uint64_t high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+    return low ^ high;
+#endif
+}
+
+inline uint64_t read_u64(const char* data)
+{
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief A seed that differs from one process to the next, so that inputs cannot be crafted in advance to collide in
+ * the hash tables it seeds
+*/
+inline uint64_t process_seed()
+{
+    static const uint64_t value = uint64_t(reinterpret_cast<uintptr_t>(&value))
+        ^ uint64_t(std::chrono::steady_clock::now().time_since_epoch().count()) * 0x9E3779B97F4A7C15ull;
+    return value;
+}
+
+/**
+ * @brief Fast non-cryptographic 128 bit hash (two independent multiply-fold lanes over 16 byte blocks). Good enough
+ * to identify documents by content, not meant to resist deliberately crafted collisions: users that cannot afford
+ * one seed it with process_seed() and compare the inputs of matching hashes
+*/
+inline Hash128 hash128(const std::string_view data, uint64_t seed = 0)
+{
+    constexpr uint64_t k0 = 0xa0761d6478bd642full, k1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t k2 = 0x8ebc6af09c88c6e3ull, k3 = 0x589965cc75374cc3ull;
+    uint64_t lane0 = seed ^ k0;
+    uint64_t lane1 = seed ^ k2 ^ (uint64_t(data.size()) * k1);
+
+    const char* p = data.data();
+    size_t remaining = data.size();
+    for(; remaining >= 16; p += 16, remaining -= 16) {
+        uint64_t a = read_u64(p), b = read_u64(p + 8);
+        lane0 = multiply_fold(a ^ k1 ^ lane0, b ^ k2);
+        lane1 = multiply_fold(b ^ k3 ^ lane1, a ^ k0) + lane0;
+    }
+    char tail[16] = {};
+    std::memcpy(tail, p, remaining);
+    uint64_t a = read_u64(tail), b = read_u64(tail + 8);
+    lane0 = multiply_fold(a ^ k1 ^ lane0, b ^ k2 ^ remaining);
+    lane1 = multiply_fold(b ^ k3 ^ lane1, a ^ k0 ^ remaining);
+
+    return {multiply_fold(lane0 ^ data.size(), k3), multiply_fold(lane1 ^ lane0, k1 ^ data.size())};
+}
+
+}
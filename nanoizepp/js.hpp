@@ -0,0 +1,484 @@
+#pragma once
+
+#include "sink.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+namespace js
+{
+
+enum CharClass : uint8_t
+{
+    // Characters of identifiers, keywords and numbers. Non-ASCII is included: it is copied as it is, and keeping
+    // the spaces around it is always safe
+    WordChar = 1,
+    // Whitespace, line terminators included
+    Space = 2,
+    // Line terminators
+    Newline = 4,
+};
+
+constexpr std::array<uint8_t, 256> make_char_classes()
+{
+    std::array<uint8_t, 256> classes{};
+    for(int c = 0; c < 256; c++) {
+        if((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$'
+            || c == '\\' || c == '#' || c >= 0x80)
+            classes[c] |= WordChar;
+    }
+    for(unsigned char c : std::string_view(" \t\v\f\r\n"))
+        classes[c] |= Space;
+    classes['\r'] |= Newline;
+    classes['\n'] |= Newline;
+    return classes;
+}
+
+inline constexpr std::array<uint8_t, 256> char_classes = make_char_classes();
+
+constexpr bool is_word_char(char c) { return char_classes[(unsigned char)c] & WordChar; }
+constexpr bool is_space(char c) { return char_classes[(unsigned char)c] & Space; }
+constexpr bool is_newline(char c) { return char_classes[(unsigned char)c] & Newline; }
+constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+
+/**
+ * @brief Keywords after which a `/` starts a regular expression rather than a division
+*/
+constexpr bool precedes_expression(const std::string_view word)
+{
+    for(std::string_view keyword : {"return", "typeof", "instanceof", "in", "of", "new", "delete", "void", "throw",
+            "case", "do", "else", "yield", "await"}) {
+        if(word == keyword)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Keywords followed by a parenthesized condition, a `/` after the `)` starts a regular expression
+*/
+constexpr bool precedes_condition(const std::string_view word)
+{
+    return word == "if" || word == "while" || word == "for" || word == "with";
+}
+
+}
+
+/**
+ * @brief Conservative JavaScript compactor writing straight to a sink, without allocating
+ *
+ * Strings, template literals, regular expressions and comments are tokenized so only whitespace and comments outside
+ * of them are removed (block comments starting with `!`, usually licenses, are kept). A regular expression is told
+ * from a division by the token before it, the usual heuristic of minifiers like JSMin, improved for `if (...) /re/`.
+ * Line breaks are kept wherever automatic semicolon insertion might depend on them: they are only removed after a
+ * token that cannot end a statement or before one that cannot start one.
+ *
+ * run() returns false when the script does not tokenize (an unterminated string, a line break in a regular
+ * expression...), which is also how a mistaken regular expression guess usually shows. The output is then not
+ * reliable and the script should be copied as it is, see compact_javascript().
+*/
+template <typename Sink>
+class JsCompactor
+{
+public:
+    explicit JsCompactor(Sink& out) : out(out) {}
+
+    bool run(const std::string_view script)
+    {
+        text = script;
+        copy = {};
+        last = '\0';
+        before_last = '\0';
+        pending = Pending::None;
+        regex_allowed = true;
+        after_regex = false;
+        condition_keyword = false;
+        brace_depth = 0;
+        template_braces = 0;
+        paren_depth = 0;
+        condition_parens = 0;
+
+        size_t i = 0;
+        // A hashbang is only allowed at the very start
+        if(text.starts_with("#!")) {
+            i = std::min(text.find('\n'), text.size());
+            write(text.substr(0, i));
+        }
+        while(i < text.size()) {
+            i = step(i);
+            if(i == std::string_view::npos)
+                return false;
+        }
+        flush();
+        return true;
+    }
+
+private:
+    enum class Pending : uint8_t
+    {
+        None,
+        Space,
+        Newline,
+    };
+
+    // Deeper template literal substitutions than this are not supported, parentheses deeper than this are
+    // assumed not to follow `if`
+    static constexpr size_t max_tracked_depth = 64;
+
+    /**
+     * @brief Handle the token at `i`
+     * @return Position of the next token, npos if the script does not tokenize
+    */
+    size_t step(size_t i)
+    {
+        const char c = text[i];
+        if(js::is_word_char(c))
+            return write_word(i);
+        if(js::is_space(c)) {
+            size_t end = i;
+            bool newline = false;
+            while(end < text.size() && js::is_space(text[end]))
+                newline |= js::is_newline(text[end++]);
+            add_pending(newline ? Pending::Newline : Pending::Space);
+            return end;
+        }
+
+        switch(c) {
+        case '/':
+            if(i + 1 < text.size() && text[i + 1] == '/') {
+                // The line break ending the comment is handled as whitespace
+                size_t end = text.find_first_of("\r\n", i);
+                add_pending(Pending::Space);
+                return end == std::string_view::npos ? text.size() : end;
+            }
+            if(i + 1 < text.size() && text[i + 1] == '*') {
+                size_t end = text.find("*/", i + 2);
+                if(end == std::string_view::npos)
+                    return std::string_view::npos;
+                end += 2;
+                auto comment = text.substr(i, end - i);
+                if(comment.starts_with("/*!")) {
+                    write(comment);
+                    return end;
+                }
+                // A comment containing a line break counts as one
+                add_pending(comment.find_first_of("\r\n") == std::string_view::npos ? Pending::Space
+                    : Pending::Newline);
+                return end;
+            }
+            if(regex_allowed)
+                return write_regex(i);
+            break;
+        case '"':
+        case '\'':
+            return write_string(i);
+        case '`':
+            return write_template(i, i + 1);
+        case '{':
+            write(text.substr(i, 1));
+            if(brace_depth < max_tracked_depth)
+                template_braces &= ~(uint64_t(1) << brace_depth);
+            brace_depth++;
+            regex_allowed = true;
+            return i + 1;
+        case '}':
+            if(brace_depth != 0) {
+                brace_depth--;
+                // End of a template literal substitution
+                if(brace_depth < max_tracked_depth && (template_braces >> brace_depth) & 1)
+                    return write_template(i, i + 1);
+            }
+            write(text.substr(i, 1));
+            regex_allowed = true;
+            return i + 1;
+        case '(': {
+            bool condition = condition_keyword;
+            write(text.substr(i, 1));
+            if(paren_depth < max_tracked_depth) {
+                if(condition)
+                    condition_parens |= uint64_t(1) << paren_depth;
+                else
+                    condition_parens &= ~(uint64_t(1) << paren_depth);
+            }
+            paren_depth++;
+            regex_allowed = true;
+            return i + 1;
+        }
+        case ')':
+            write(text.substr(i, 1));
+            regex_allowed = false;
+            if(paren_depth != 0) {
+                paren_depth--;
+                regex_allowed = paren_depth < max_tracked_depth && (condition_parens >> paren_depth) & 1;
+            }
+            return i + 1;
+        case ']':
+            write(text.substr(i, 1));
+            regex_allowed = false;
+            return i + 1;
+        case '+':
+        case '-': {
+            // `a++ / b` is a division, `++` and `--` only come before an operand as prefixes
+            bool increment = pending == Pending::None && last == c;
+            write(text.substr(i, 1));
+            regex_allowed = increment == false;
+            return i + 1;
+        }
+        }
+        write(text.substr(i, 1));
+        regex_allowed = true;
+        return i + 1;
+    }
+
+    size_t write_word(size_t i)
+    {
+        size_t end = i + 1;
+        while(end < text.size() && js::is_word_char(text[end]))
+            end++;
+        auto word = text.substr(i, end - i);
+        // `a.return / b` is a property, not a keyword
+        bool property = pending == Pending::None && last == '.';
+        write(word);
+        regex_allowed = property == false && js::precedes_expression(word);
+        condition_keyword = property == false && js::precedes_condition(word);
+        return end;
+    }
+
+    size_t write_string(size_t i)
+    {
+        const char quote = text[i];
+        size_t end = i + 1;
+        while(end < text.size() && text[end] != quote) {
+            if(text[end] == '\\')
+                // A line continuation may be a CR LF pair
+                end += text.substr(end + 1, 2) == "\r\n" ? 3 : 2;
+            else if(js::is_newline(text[end]))
+                return std::string_view::npos;
+            else
+                end++;
+        }
+        if(end >= text.size())
+            return std::string_view::npos;
+        write(text.substr(i, end + 1 - i));
+        regex_allowed = false;
+        return end + 1;
+    }
+
+    /**
+     * @brief Write the part of a template literal starting at `i` (a backquote or the `}` ending a substitution),
+     * up to its end or the start of the next substitution
+    */
+    size_t write_template(size_t i, size_t start)
+    {
+        size_t end = start;
+        while(end < text.size() && text[end] != '`' && (text[end] != '$' || text.substr(end + 1, 1) != "{"))
+            end += text[end] == '\\' ? 2 : 1;
+        if(end >= text.size())
+            return std::string_view::npos;
+        if(text[end] == '`') {
+            write(text.substr(i, end + 1 - i));
+            regex_allowed = false;
+            return end + 1;
+        }
+        if(brace_depth >= max_tracked_depth)
+            return std::string_view::npos;
+        write(text.substr(i, end + 2 - i));
+        template_braces |= uint64_t(1) << brace_depth;
+        brace_depth++;
+        regex_allowed = true;
+        return end + 2;
+    }
+
+    size_t write_regex(size_t i)
+    {
+        size_t end = i + 1;
+        bool in_class = false;
+        while(end < text.size() && (text[end] != '/' || in_class)) {
+            if(js::is_newline(text[end]))
+                return std::string_view::npos;
+            if(text[end] == '\\')
+                end++;
+            else if(text[end] == '[')
+                in_class = true;
+            else if(text[end] == ']')
+                in_class = false;
+            end++;
+        }
+        if(end >= text.size())
+            return std::string_view::npos;
+        end++;
+        while(end < text.size() && js::is_word_char(text[end]))
+            end++;
+        write(text.substr(i, end - i));
+        regex_allowed = false;
+        after_regex = true;
+        return end;
+    }
+
+    void add_pending(Pending whitespace)
+    {
+        if(whitespace > pending)
+            pending = whitespace;
+    }
+
+    /**
+     * @brief Write `s`, a part of the text, preceded by the whitespace still pending if it is needed
+    */
+    void write(const std::string_view s)
+    {
+        const char next = s[0];
+        if(pending == Pending::Newline && newline_needed(next)) {
+            flush();
+            out.append(1, '\n');
+            before_last = last;
+            last = '\n';
+        }
+        else if(pending != Pending::None && space_needed(next)) {
+            flush();
+            out.append(1, ' ');
+            before_last = last;
+            last = ' ';
+        }
+        pending = Pending::None;
+        if(copy.empty() == false && copy.data() + copy.size() == s.data())
+            copy = std::string_view(copy.data(), copy.size() + s.size());
+        else {
+            flush();
+            copy = s;
+        }
+        before_last = s.size() > 1 ? s[s.size() - 2] : last;
+        last = s.back();
+        after_regex = false;
+        condition_keyword = false;
+    }
+
+    /**
+     * @brief Write the text copied as it is so far
+    */
+    void flush()
+    {
+        if(copy.empty() == false)
+            out.append(copy);
+        copy = {};
+    }
+
+    /**
+     * @brief false if a line break before `next` can be removed without changing how semicolons are inserted
+    */
+    bool newline_needed(char next) const
+    {
+        if(last == '\0')
+            return false;
+        // These cannot start a statement, no semicolon is inserted before them
+        if(std::string_view(";,)]}").find(next) != std::string_view::npos)
+            return false;
+        // Operators and openings cannot end one, except `++` and `--` (postfix) and `/` (end of a regex)
+        if(std::string_view("{([,;:=*%&|^!~<>?").find(last) != std::string_view::npos)
+            return false;
+        if((last == '+' || last == '-') && before_last != last)
+            return false;
+        return true;
+    }
+
+    bool space_needed(char next) const
+    {
+        if(last == '\0')
+            return false;
+        if(js::is_word_char(next) && (js::is_word_char(last) || after_regex))
+            return true;
+        // `1 .toString()`
+        if(js::is_digit(last) && next == '.')
+            return true;
+        // `a + +b`, `a / /re/`, and no `<!`, `</` or `->` that the HTML parser or the JS one could take for more
+        for(std::string_view pair : {"++", "--", "//", "/*", "<!", "</", "->", ".."}) {
+            if(last == pair[0] && next == pair[1])
+                return true;
+        }
+        return false;
+    }
+
+    Sink& out;
+    std::string_view text;
+    // Output not written yet, a part of `text` that is copied unchanged
+    std::string_view copy;
+    // Last two characters written, 0 if none
+    char last = '\0';
+    char before_last = '\0';
+    Pending pending = Pending::None;
+    // A `/` here starts a regular expression
+    bool regex_allowed = true;
+    bool after_regex = false;
+    // The last token is `if`, `while`, `for` or `with`
+    bool condition_keyword = false;
+    // Open braces, and which ones are template literal substitutions
+    size_t brace_depth = 0;
+    uint64_t template_braces = 0;
+    // Open parentheses, and which ones follow a condition keyword
+    size_t paren_depth = 0;
+    uint64_t condition_parens = 0;
+};
+
+/**
+ * @brief Compact the content of a <script> element, or copy it as it is when that would not be safe
+*/
+template <typename Sink>
+void compact_javascript(const std::string_view script, Sink& out)
+{
+    // HTML-like comments are comments in JS as well, and change how the HTML parser finds the end of the script
+    if(script.find("<!--") != std::string_view::npos || script.find("-->") != std::string_view::npos) {
+        out.append(script);
+        return;
+    }
+    // Check the script tokenizes before writing anything
+    DiscardSink discard;
+    if(JsCompactor<DiscardSink>(discard).run(script) == false) {
+        out.append(script);
+        return;
+    }
+    JsCompactor<Sink>(out).run(script);
+}
+
+/**
+ * @brief Remove the whitespace between the tokens of a JSON script block. Whitespace that separates two words or
+ * numbers is kept as a single space, so invalid JSON stays invalid
+*/
+template <typename Sink>
+void compact_json(const std::string_view json, Sink& out)
+{
+    constexpr std::string_view punctuators = "{}[]:,\"";
+    size_t start = 0;
+    size_t i = 0;
+    while(i < json.size()) {
+        const char c = json[i];
+        if(c == '"') {
+            i++;
+            while(i < json.size() && json[i] != '"')
+                i += json[i] == '\\' ? 2 : 1;
+            i = std::min(i + 1, json.size());
+            continue;
+        }
+        if(c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            i++;
+            continue;
+        }
+        size_t end = i;
+        while(end < json.size() && (json[end] == ' ' || json[end] == '\t' || json[end] == '\n' || json[end] == '\r'))
+            end++;
+        out.append(json.substr(start, i - start));
+        bool separates = i != 0 && end != json.size() && punctuators.find(json[i - 1]) == std::string_view::npos
+            && punctuators.find(json[end]) == std::string_view::npos;
+        if(separates)
+            out.append(1, ' ');
+        start = end;
+        i = end;
+    }
+    out.append(json.substr(start));
+}
+
+}
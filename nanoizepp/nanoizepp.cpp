@@ -1,406 +1,529 @@
 #include "nanoizepp.hpp"
+#include "parser.hpp"
+#include "emitter.hpp"
+#include "sink.hpp"
+#include "arena.hpp"
+#include "parallel.hpp"
+#include "stats.hpp"
+#include "transform_handler.hpp"
 
 #include <string>
 #include <vector>
-#include <map>
+#include <memory_resource>
+#include <optional>
+#include <span>
 #include <string_view>
-#include <stack>
-#include <set>
-#include <iostream>
 #include <algorithm>
-#include <cassert>
+#include <chrono>
 
 using namespace nanoizepp;
+using namespace nanoizepp::detail;
 
+/**
+ * @brief Node of the DOM built by the tree engine. Nodes are allocated from an Arena and freed all at once.
+ * Attributes and raw text point into the input, tag names into the parser's tag table. Only text rewritten by
+ * minimization is copied into the arena
+*/
 struct HTMLNode
 {
-    HTMLNode(std::string tag, std::map<std::string, std::string> attributes={}, std::vector<HTMLNode> children={})
-        : tag(tag), attributes(attributes), children(children)
+    Tag tag;
+    std::string_view text;
+    std::span<const Attribute> attributes;
+    HTMLNode* first_child = nullptr;
+    HTMLNode* last_child = nullptr;
+    HTMLNode* next_sibling = nullptr;
+    bool is_text = false;
+
+    void append_child(HTMLNode* child)
     {
-        assert(tag != "");
+        if(last_child == nullptr)
+            first_child = child;
+        else
+            last_child->next_sibling = child;
+        last_child = child;
     }
+};
 
-    HTMLNode(std::string tag, std::string text, std::map<std::string, std::string> attributes={}, std::vector<HTMLNode> children={})
-        : tag(tag), text(text), attributes(attributes), children(children)
+/**
+ * @brief How the text nodes of `parent` are written
+*/
+static TextKind children_text_kind(const HTMLNode& parent, const Options& options)
+{
+    return has_flag(parent.tag.id, TagFlags::RawText) ? raw_text_kind(parent.tag, parent.attributes, options)
+        : html_text_kind(options);
+}
+
+/**
+ * @brief Write the children of `root`. The tree is walked with an explicit stack of the elements being written
+ * instead of recursion, so a document of any depth fits on the call stack
+ * @param stack Scratch memory, reused across documents
+*/
+template <typename Sink>
+static void serialize_html_tree(const HTMLNode& root, Sink& out, const Options& options,
+    std::pmr::vector<const HTMLNode*>& stack)
+{
+    const size_t indent = options.indent;
+    stack.clear();
+    stack.push_back(&root);
+    const HTMLNode* node = root.first_child;
+    while(true) {
+        if(node == nullptr) {
+            // All the children of the innermost element are written
+            const HTMLNode* parent = stack.back();
+            stack.pop_back();
+            if(stack.empty())
+                break;
+            if(indent != 0)
+                out.append(indent * (stack.size() - 1), ' ');
+            append_end_tag(out, parent->tag);
+            if(options.newline)
+                out.append(1, '\n');
+            node = parent->next_sibling;
+            continue;
+        }
+
+        // Depth of `node`, the children of the root are at depth 1
+        const size_t depth = stack.size();
+        if(indent != 0)
+            out.append(indent * (depth - 1), ' ');
+        if(node->is_text) {
+            const TextKind kind = children_text_kind(*stack.back(), options);
+            append_text(out, placeholder_text_kind(kind, node->text, options), node->text);
+        }
+        else
+            append_start_tag(out, node->tag, node->attributes, options);
+        if(options.newline)
+            out.append(1, '\n');
+        if(node->is_text || has_flag(node->tag.id, TagFlags::Void)) {
+            node = node->next_sibling;
+            continue;
+        }
+        stack.push_back(node);
+        node = node->first_child;
+    }
+}
+
+/**
+ * @brief Parser handler that builds a HTMLNode tree
+*/
+class TreeBuilder
+{
+public:
+    TreeBuilder(Arena& arena, std::pmr::memory_resource* resource) : arena(arena), node_stack(resource)
     {
-        assert(tag != "");
+        node_stack.reserve(32);
     }
-    std::string tag;
-    std::string text;
-    std::map<std::string, std::string> attributes;
-    std::vector<HTMLNode> children;
-};
 
-static const std::set<std::string> self_closed_tags = {
-    "area", "base", "br", "col", "embed", "hr", "img", "input", "link",
-    "meta", "param", "source", "track", "wbr", "!DOCTYPE"
-};
+    /**
+     * @brief Start a new document under `root`
+    */
+    void reset(HTMLNode& root)
+    {
+        node_stack.clear();
+        node_stack.push_back(&root);
+    }
 
-static const std::set<std::string> tags_never_minimize_content = {
-    "script", "style", "pre", "code", "textarea", "plaintext", "samp", "kbd", "var"
-};
+    void open(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        auto node = make_element(tag, attributes);
+        node_stack.back()->append_child(node);
+        node_stack.push_back(node);
+    }
+
+    void void_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        node_stack.back()->append_child(make_element(tag, attributes));
+    }
+
+    void text(const std::string_view text)
+    {
+        // The parser reuses its buffer for minimized text, keep a copy
+        raw_text(arena.copy(text));
+    }
+
+    void raw_text(const std::string_view text)
+    {
+        auto node = arena.make<HTMLNode>();
+        node->text = text;
+        node->is_text = true;
+        node_stack.back()->append_child(node);
+    }
 
-static const std::set<std::string> tags_cdata_allowed = {
-    "svg", "math"
+    void close(const Tag)
+    {
+        if(node_stack.size() <= 1)
+            throw std::runtime_error("Nanoize++: Internal error: node_stack is empty");
+        node_stack.pop_back();
+    }
+
+private:
+    HTMLNode* make_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        auto node = arena.make<HTMLNode>();
+        node->tag = tag;
+        node->attributes = arena.copy(attributes);
+        return node;
+    }
+
+    Arena& arena;
+    std::pmr::vector<HTMLNode*> node_stack;
 };
 
-static std::string serialize_html_node(const HTMLNode& root, size_t indent, bool newline, std::string current = "", int depth = 0)
+/**
+ * @brief State of the tree engine, reusable across documents
+*/
+template <typename Stats = NoStats>
+class TreeEngine
 {
-    bool is_text = root.tag == "NANOIZEPP-PLAINTEXT";
-    if(depth != 0) {
-        if(indent != 0)
-            current += std::string(indent * (depth-1), ' ');
-        if(is_text == false) {
-            current += "<" + root.tag;
-            for(const auto& [key, value] : root.attributes) {
-                if(value == "") {
-                    if(root.tag == "audio" || root.tag == "video" || root.tag == "!DOCTYPE")
-                        current += " " + key;
-                }
-                else
-                    current += " " + key + "=\"" + value + "\"";
-            }
-            current += ">";
-        }
-        else {
-            current += root.text + "";
-        }
-        if(newline)
-            current += "\n";
+public:
+    explicit TreeEngine(std::pmr::memory_resource* resource)
+        : arena(16 * 1024, resource), builder(arena, resource), parser(builder, resource), serialize_stack(resource)
+    {
     }
-    for(const auto& child : root.children) {
-        current = serialize_html_node(child, indent, newline, current, depth + 1);
+
+    void set_stats(const Stats& stats) { parser.set_stats(stats); }
+
+    template <typename Sink>
+    void run(const std::string_view html, Sink& out, const Options& options)
+    {
+        parse(html, options);
+        serialize(out, options);
     }
-    if(depth != 0 && !is_text && self_closed_tags.contains(root.tag) == false) {
-        if(indent != 0)
-            current += std::string(indent * (depth-1), ' ');
-        current += "</" + root.tag + ">";
-        if(newline)
-            current += "\n";
+
+    void parse(const std::string_view html, const Options& options)
+    {
+        arena.reset();
+        document_root = {};
+        builder.reset(document_root);
+        parser.reset();
+        parser.set_limits(tree_limits(options));
+        parser.parse(html, true);
+        parser.finish();
     }
-    return current;
+
+    template <typename Sink>
+    void serialize(Sink& out, const Options& options)
+    {
+        serialize_html_tree(document_root, out, options, serialize_stack);
+    }
+
+private:
+    Arena arena;
+    HTMLNode document_root;
+    TreeBuilder builder;
+    Parser<TreeBuilder, Stats> parser;
+    std::pmr::vector<const HTMLNode*> serialize_stack;
+};
+
+template <typename Sink>
+static void nanoize_single_pass(const std::string_view html, Sink& out, const Options& options,
+    std::pmr::memory_resource* resource)
+{
+    Emitter<Sink> emitter(out, options);
+    Parser<Emitter<Sink>> parser(emitter, resource);
+    parser.set_limits(tree_limits(options));
+    parser.parse(html, true);
+    parser.finish();
 }
 
-static std::string minimize_html_text(const std::string_view sv)
+/**
+ * @brief Run the tree engine, timing parsing and serializing separately
+*/
+template <typename Sink>
+static void run_tree_engine(TreeEngine<StatsRecorder>& engine, const std::string_view html, Sink& out,
+    const Options& options, DocumentStats& stats)
 {
-    std::string_view text = sv;
-    std::string minimized_text;
-    minimized_text.reserve(text.size());
-    bool last_was_space = false;
-    while(text.empty() == false) {
-        auto space = text.find_first_of(" \t\n\r");
-        if(space == std::string_view::npos) {
-            minimized_text += text;
-            break;
-        }
-        minimized_text += std::string(text.substr(0, space));
-        minimized_text += " ";
-
-        text = text.substr(space);
-        auto non_space = text.find_first_not_of(" \t\n\r");
-        if(non_space == std::string_view::npos)
-            break;
-        text = text.substr(non_space);
+    auto start = std::chrono::steady_clock::now();
+    engine.set_stats(StatsRecorder{&stats});
+    engine.parse(html, options);
+    auto parsed = std::chrono::steady_clock::now();
+    engine.serialize(out, options);
+    stats.parse_time = parsed - start;
+    stats.serialize_time = std::chrono::steady_clock::now() - parsed;
+}
+
+template <typename Sink>
+static void run_single_pass(Parser<Emitter<Sink>, StatsRecorder>& parser, const std::string_view html,
+    DocumentStats& stats)
+{
+    auto start = std::chrono::steady_clock::now();
+    parser.set_stats(StatsRecorder{&stats});
+    parser.reset();
+    parser.parse(html, true);
+    parser.finish();
+    stats.parse_time = std::chrono::steady_clock::now() - start;
+}
+
+static bool has_limits(const Options& options)
+{
+    return options.max_depth != 0 || options.max_nodes != 0 || options.max_output != 0;
+}
+
+static bool use_parallel(const std::string_view html, const Options& options)
+{
+    // Segments are serialized independently, limits are only enforced in order
+    return options.engine == Engine::SinglePass && resolve_thread_count(options.threads) > 1
+        && html.size() >= 2 * min_parallel_segment_size && has_limits(options) == false;
+}
+
+template <typename Sink>
+static void nanoize_into(const std::string_view html, Sink& out, const Options& options,
+    std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    if(options.engine == Engine::Tree)
+        TreeEngine<>(resource).run(html, out, options);
+    else if(use_parallel(html, options))
+        nanoize_parallel(html, out, options, resolve_thread_count(options.threads));
+    else
+        nanoize_single_pass(html, out, options, resource);
+}
+
+std::string nanoizepp::nanoize(const std::string_view html, size_t indent, bool newline)
+{
+    Options options;
+    options.indent = indent;
+    options.newline = newline;
+    return nanoize(html, options);
+}
+
+std::string nanoizepp::nanoize(const std::string_view html, const Options& options)
+{
+    std::string result;
+    nanoize(html, result, options);
+    return result;
+}
+
+void nanoizepp::nanoize(const std::string_view html, std::string& out, const Options& options)
+{
+    prepare_output(out, html, options);
+    StringSink sink(out);
+    sink.set_max_output(options.max_output);
+    nanoize_into(html, sink, options);
+}
+
+void nanoizepp::nanoize(const std::string_view html, std::vector<char>& out, const Options& options)
+{
+    prepare_output(out, html, options);
+    VectorSink sink(out);
+    sink.set_max_output(options.max_output);
+    nanoize_into(html, sink, options);
+}
+
+void nanoizepp::nanoize(const std::string_view html, const std::function<void(std::string_view)>& callback, const Options& options)
+{
+    CallbackSink sink(callback);
+    sink.set_max_output(options.max_output);
+    nanoize_into(html, sink, options);
+    sink.flush();
+}
+
+std::pmr::string nanoizepp::nanoize(const std::string_view html, std::pmr::memory_resource* resource, const Options& options)
+{
+    std::pmr::string result(resource);
+    nanoize(html, result, options);
+    return result;
+}
+
+void nanoizepp::nanoize(const std::string_view html, std::pmr::string& out, const Options& options)
+{
+    prepare_output(out, html, options);
+    PmrStringSink sink(out);
+    sink.set_max_output(options.max_output);
+    nanoize_into(html, sink, options, out.get_allocator().resource());
+}
+
+void nanoizepp::nanoize(const std::string_view html, std::string& out, const Options& options, DocumentStats& stats)
+{
+    auto start = std::chrono::steady_clock::now();
+    stats = {};
+    stats.input_bytes = html.size();
+    bool reserved = prepare_output(out, html, options);
+    auto capacity = out.capacity();
+
+    CountingResource resource(std::pmr::get_default_resource());
+    StringSink sink(out);
+    sink.set_max_output(options.max_output);
+    if(options.engine == Engine::Tree) {
+        TreeEngine<StatsRecorder> engine(&resource);
+        run_tree_engine(engine, html, sink, options, stats);
+    }
+    else {
+        Emitter<StringSink> emitter(sink, options);
+        Parser<Emitter<StringSink>, StatsRecorder> parser(emitter, &resource);
+        parser.set_limits(tree_limits(options));
+        run_single_pass(parser, html, stats);
     }
-    // replace NUL characters with U+FFFD
-    do {
-        auto nul = minimized_text.find('\0');
-        if(nul == std::string_view::npos)
-            break;
-        minimized_text.replace(nul, 1, "\xEF\xBF\xBD");
-    } while(true);
-    if(minimized_text == " ")
-        minimized_text = "";
-    return minimized_text;
+
+    stats.output_bytes = out.size();
+    stats.allocations = resource.allocations() + (reserved || out.capacity() != capacity ? 1 : 0);
+    stats.total_time = std::chrono::steady_clock::now() - start;
 }
 
 /**
- * @brief Parse attributes from a tag without the tag name
- * @param sv String to parse attributes from ex: " id=\"test\" class=\"test\"> ..."
+ * @brief Run the engine `options` select over `html` with a single pass writer kept between documents
 */
-static std::pair<std::string_view, std::map<std::string, std::string>> parse_attributes(const std::string_view sv)
+template <typename Sink>
+static void run_minimizer(const std::string_view html, Sink& sink, Emitter<Sink>& emitter,
+    Parser<Emitter<Sink>>& parser, std::optional<TreeEngine<>>& tree, const Options& options)
 {
-    std::map<std::string, std::string> attributes;
-    std::string_view remaining = sv;
-    while(remaining.empty() == false) {
-        // skip whitespaces and / (because HTML5 standard)
-        auto whitespace = remaining.find_first_not_of(" \t\n\r/");
-        if(whitespace == std::string_view::npos)
-            break;
-        remaining = remaining.substr(whitespace);
-        // check if we are at the end of the tag
-        if(remaining[0] == '>')
-            break;
-
-        // find the attribute name
-        auto attribute_name_end = remaining.find_first_of(" \t\n\r=>");
-        if(attribute_name_end == std::string_view::npos)
-            break;
-        auto attribute_name = remaining.substr(0, attribute_name_end);
-        remaining = remaining.substr(attribute_name_end);
-        // skip whitespaces
-        whitespace = remaining.find_first_not_of(" \t\n\r");
-        if(whitespace == std::string_view::npos)
-            break;
-        // We expect an = here
-        if(remaining[whitespace] != '=') {
-            remaining = remaining.substr(whitespace);
-            if(attributes.contains(std::string(attribute_name)) == false)
-                attributes[std::string(attribute_name)] = "";
-            continue;
-        }
-        remaining = remaining.substr(whitespace + 1);
-        // skip whitespaces
-        whitespace = remaining.find_first_not_of(" \t\n\r");
-        remaining = remaining.substr(whitespace);
-        // check if we are at the end of the tag
-        if(remaining[0] == '>') {
-            attributes[std::string(attribute_name)] = "";
-            break;
-        }
-        // now we should be at the start of the attribute value
-        std::string_view attribute_value;
-        if(remaining[0] != '"') {
-            // attribute value is not quoted, find the next whitespace
-            auto attribute_value_end = remaining.find_first_of(" \t\n\r>");
-            attribute_value = remaining.substr(0, attribute_value_end);
-            remaining = remaining.substr(attribute_value_end);
-        }
-        else {
-            // attribute value is quoted, find the next quote
-            remaining = remaining.substr(1);
-            auto attribute_value_end = remaining.find_first_of("\"");
-            // pretend to have the quote at the end of the string
-            if(attribute_value_end == std::string_view::npos) {
-                attribute_value = remaining;
-                remaining = std::string_view();
-            }
-            else {
-                attribute_value = remaining.substr(0, attribute_value_end);
-                remaining = remaining.substr(attribute_value_end + 1);
-            }
-        }
+    sink.set_max_output(options.max_output);
+    if(tree)
+        tree->run(html, sink, options);
+    else if(use_parallel(html, options))
+        nanoize_parallel(html, sink, options, resolve_thread_count(options.threads));
+    else {
+        emitter.reset();
+        parser.reset();
+        parser.parse(html, true);
+        parser.finish();
+    }
+}
 
-        if(attributes.contains(std::string(attribute_name)))
-            continue;
-        attributes[std::string(attribute_name)] = std::string(attribute_value);
+/**
+ * @brief Writer for Minimizer::nanoize(html, std::string&), pointed at the caller's string on each call
+*/
+struct MinimizerStringOutput
+{
+    MinimizerStringOutput(std::string& out, const Options& options, std::pmr::memory_resource* resource)
+        : sink(out), emitter(sink, options), parser(emitter, resource)
+    {
+        parser.set_limits(tree_limits(options));
+    }
+
+    StringSink sink;
+    Emitter<StringSink> emitter;
+    Parser<Emitter<StringSink>> parser;
+};
+
+/**
+ * @brief Parser for Minimizer::nanoize(html, transforms), writing through the minimizer's emitter
+*/
+struct MinimizerTransformParser
+{
+    MinimizerTransformParser(Emitter<PmrStringSink>& emitter, const Options& options,
+        std::pmr::memory_resource* resource)
+        : handler(emitter, {}), parser(handler, resource)
+    {
+        parser.set_limits(tree_limits(options));
     }
 
-    if(remaining.empty() == false && remaining[0] == '>')
-        remaining = remaining.substr(1);
-    return {remaining, attributes};
+    TransformHandler<PmrStringSink> handler;
+    Parser<TransformHandler<PmrStringSink>> parser;
+};
+
+struct Minimizer::Impl
+{
+    Impl(const Options& options, std::pmr::memory_resource* resource)
+        : options(options), counting_resource(resource), output(resource), sink(output),
+          emitter(sink, options), parser(emitter, resource)
+    {
+        parser.set_limits(tree_limits(options));
+        if(options.engine == Engine::Tree)
+            tree.emplace(resource);
+    }
+
+    Options options;
+    // Used by the statistics collecting engines, created on first use
+    CountingResource counting_resource;
+    std::pmr::string output;
+    PmrStringSink sink;
+    Emitter<PmrStringSink> emitter;
+    Parser<Emitter<PmrStringSink>> parser;
+    std::optional<TreeEngine<>> tree;
+    std::optional<Parser<Emitter<PmrStringSink>, StatsRecorder>> stats_parser;
+    std::optional<TreeEngine<StatsRecorder>> stats_tree;
+    // Used by nanoize(html, std::string&), created on first use
+    std::optional<MinimizerStringOutput> string_output;
+    // Used by nanoize(html, transforms), created on first use
+    std::optional<MinimizerTransformParser> transform_parser;
+};
+
+Minimizer::Minimizer(const Options& options, std::pmr::memory_resource* resource)
+    : impl(std::make_unique<Impl>(options, resource))
+{
 }
 
-std::string nanoizepp::nanoize(const std::string_view html, size_t indent, bool newline)
+Minimizer::~Minimizer() = default;
+Minimizer::Minimizer(Minimizer&&) noexcept = default;
+Minimizer& Minimizer::operator=(Minimizer&&) noexcept = default;
+
+std::string_view Minimizer::nanoize(const std::string_view html)
 {
-    HTMLNode document_root("NANOIZEPP-ROOT");
-    std::vector<HTMLNode*> node_stack;
-    node_stack.reserve(32);
-    node_stack.push_back(&document_root);
-    std::string_view remaining_html = html;
-    while(remaining_html.empty() == false) {
-        if(node_stack.empty())
-            throw std::runtime_error("Nanoize++: Internal error: node_stack is empty");
-        auto current_node = node_stack.back();
-
-        // skip whitespaces and see if we can find the start of a tag
-        auto whitespace = remaining_html.find_first_not_of(" \t\n\r");
-        // Only speces and newlines left, we are done
-        if(whitespace == std::string_view::npos)
-            break;
-        // We found something, is it a start of a tag?
-        if(remaining_html[0] == '<') {
-            remaining_html = remaining_html.substr(whitespace).substr(1);
-            if(remaining_html.empty()) {
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "<"));
-                break;
-            }
-
-            // Is it a comment?
-            if(remaining_html.size() >= 3 && remaining_html.starts_with("!--")) {
-                // check if it is `abrupt-closing-of-empty-comment` (<!-->)
-                auto sv = remaining_html.substr(3);
-                auto possibe_end = sv.find_first_not_of("-");
-                if(possibe_end == std::string_view::npos)
-                    break;
-                if(sv[possibe_end] == '>') {
-                    remaining_html = sv.substr(possibe_end + 1);
-                    continue;
-                }
-
-                // It's not, let's try to find the end of the comment
-                auto comment_end = remaining_html.find("-->");
-                size_t end_size = 3;
-                if(comment_end == std::string_view::npos) {
-                    comment_end = remaining_html.find("--!>");
-                    end_size = 4;
-                }
-
-
-                if(comment_end == std::string_view::npos) {
-                    break;
-                }
-                else {
-                    remaining_html = remaining_html.substr(comment_end + end_size);
-                    continue;
-                }
-            }
-            // Is possible to be a incorrectly-opened-comment?
-            if(remaining_html.size() >= 1 && remaining_html.starts_with("!")) {
-                // Is it really a incorrectly-opened-comment? Try by checking if the following character is
-                // not a [ (CDATA) or is DOCTYPE
-                if(remaining_html.starts_with("![CDATA[") == false && remaining_html.starts_with("!DOCTYPE") == false) {
-                    // It is, let's try to find the end of the comment
-                    auto comment_end = remaining_html.find(">");
-                    if(comment_end == std::string_view::npos) {
-                        break;
-                    }
-                    else {
-                        remaining_html = remaining_html.substr(comment_end + 1);
-                        continue;
-                    }
-                }
-                // Else it's something else, let's just skip it
-            }
-
-            // find the actual tag name
-            auto tag_begin = remaining_html.find_first_not_of(" \t\n\r");
-            if(tag_begin == std::string_view::npos) {
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "<"));
-                break;
-            }
-            remaining_html = remaining_html.substr(tag_begin);
-            auto tag_end = remaining_html.find_first_of(" \t\n\r>[");
-            if(tag_end == std::string_view::npos) {
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "<"+std::string(remaining_html)));
-                break;
-            }
-            std::string tag_name = std::string(remaining_html.substr(0, tag_end));
-            remaining_html = remaining_html.substr(tag_end);
-            bool is_self_closed = self_closed_tags.contains(tag_name);
-            // Now, it's possible we met the </ div> tag, but we only parsed the </ part. But it's fine
-            // because of auto closing.
-
-            // Check if we got CDATA and handle it
-            if(tag_name == "!" && remaining_html.starts_with("[CDATA")) {
-                // CDATA
-                auto cdata_end = remaining_html.find("]]>");
-                std::string_view cdata = remaining_html.substr(7, cdata_end - 7);
-
-                // are we in a tag allowed to have CDATA?
-                bool allowed = false;
-                for(auto it = node_stack.rbegin(); it != node_stack.rend(); ++it) {
-                    if(tags_cdata_allowed.contains((*it)->tag)) {
-                        allowed = true;
-                        break;
-                    }
-                }
-
-                remaining_html = remaining_html.substr(cdata_end + 3);
-                if(!allowed)
-                    continue;
-                // Parsing CDATA is hard. Give up and just add it as a text node
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "<![CDATA["+std::string(cdata)+"]]>"));
-                continue;
-            }
-
-            // parse attributes
-            auto [remaining, attributes] = parse_attributes(remaining_html);
-            remaining_html = remaining;
-            if(is_self_closed) {
-                if(tag_name == "!DOCTYPE" && !(attributes.size() == 1 && attributes.contains("html") && attributes["html"] == ""))
-                    throw std::runtime_error("Only HTML5 is supported by nanoizepp");
-
-                current_node->children.push_back(HTMLNode(tag_name, attributes));
-                continue;
-            }
-
-            assert(tag_name.empty() == false);
-            // Is it a closing tag?
-            if(tag_name[0] == '/') {
-                // is the tag valid?
-                if(tag_name == "/") {
-                    continue;
-                }
-
-                if(current_node->tag != tag_name.substr(1)) {
-                    // This is tricky. We are closing a tag that is not the current tag. First we try to find the tag in the stack
-                    // and close all tags in between. If we can't find it, we just ignore it.
-
-                    // But special handling for <hX> tags. We can close them if the current tag is <hY> and abs(X-Y) <= 2
-                    if(tag_name.size() == 3 && tag_name[1] == 'h' && std::isdigit(tag_name[2])) {
-                        if(current_node->tag.size() == 3 && current_node->tag[1] == 'h' && std::isdigit(current_node->tag[2])) {
-                            try {
-                                auto x = std::stoi(tag_name.substr(2));
-                                auto y = std::stoi(current_node->tag.substr(2));
-                                if(std::abs(x-y) <= 2) {
-                                    node_stack.pop_back();
-                                    continue;
-                                }
-                            }
-                            catch(...) { }
-                        }
-                    }
-
-                    auto it = std::find_if(node_stack.rbegin(), node_stack.rend(), [&](auto& node) {
-                        return node->tag == tag_name.substr(1);
-                    });
-                    if(it == node_stack.rend()) {
-                        continue;
-                    }
-                    node_stack.resize(std::distance(it, node_stack.rend()));
-                    continue;
-                }
-                node_stack.pop_back();
-                continue;
-            }
-
-            // Special handling for <script>, <pre>, <style> and alike
-            if(tags_never_minimize_content.contains(tag_name)) {
-                auto end_tag = remaining_html.find("</"+tag_name+">");
-                if(end_tag == std::string_view::npos) {
-                    current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "<"+tag_name));
-                    break;
-                }
-                current_node->children.push_back(HTMLNode(tag_name, attributes));
-                current_node->children.back().children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", std::string(remaining_html.substr(0, end_tag))));
-                remaining_html = remaining_html.substr(end_tag + tag_name.size() + 3);
-                continue;
-            }
-            // is the tag valid?
-            if(std::isdigit(tag_name[0]) == true) {
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", "&lt;"+tag_name+"&gt;"));
-                continue;
-            }
-            if(tag_name[0] == '?') {
-                continue;
-            }
-            if(tag_name.back() == '/') {
-                tag_name.pop_back();
-            }
-            current_node->children.push_back(HTMLNode(tag_name, attributes));
-            node_stack.push_back(&current_node->children.back());
-        }
-        else {
-            auto text_end = remaining_html.find('<');
-            if(text_end == std::string_view::npos) {
-                // no more tags, just text
-                std::string minimized_text = minimize_html_text(remaining_html);
-                if(minimized_text.empty())
-                    break;
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", minimized_text));
-                break;
-            }
-            else {
-                std::string_view text = remaining_html.substr(0, text_end);
-                std::string minimized_text = minimize_html_text(text);
-                remaining_html = remaining_html.substr(text_end);
-                if(minimized_text.empty())
-                    continue;
-                current_node->children.push_back(HTMLNode("NANOIZEPP-PLAINTEXT", minimized_text));
-            }
-        }
+    prepare_output(impl->output, html, impl->options);
+    impl->sink.set_target(impl->output);
+    run_minimizer(html, impl->sink, impl->emitter, impl->parser, impl->tree, impl->options);
+    return impl->output;
+}
 
+std::string_view Minimizer::nanoize(const std::string_view html, DocumentStats& stats)
+{
+    auto start = std::chrono::steady_clock::now();
+    const Options& options = impl->options;
+    stats = {};
+    stats.input_bytes = html.size();
+    size_t allocations = impl->counting_resource.allocations();
+    impl->sink.set_target(impl->output);
+    impl->sink.set_max_output(options.max_output);
+    auto capacity = impl->output.capacity();
+    prepare_output(impl->output, html, options);
+
+    if(options.engine == Engine::Tree) {
+        if(impl->stats_tree.has_value() == false)
+            impl->stats_tree.emplace(&impl->counting_resource);
+        run_tree_engine(*impl->stats_tree, html, impl->sink, options, stats);
     }
-    return serialize_html_node(document_root, indent, newline);
+    else {
+        if(impl->stats_parser.has_value() == false) {
+            impl->stats_parser.emplace(impl->emitter, &impl->counting_resource);
+            impl->stats_parser->set_limits(tree_limits(options));
+        }
+        impl->emitter.reset();
+        run_single_pass(*impl->stats_parser, html, stats);
+    }
+
+    stats.output_bytes = impl->output.size();
+    stats.allocations = impl->counting_resource.allocations() - allocations
+        + (impl->output.capacity() != capacity ? 1 : 0);
+    stats.total_time = std::chrono::steady_clock::now() - start;
+    return impl->output;
+}
+
+std::string_view Minimizer::nanoize(const std::string_view html, const std::span<Transform* const> transforms)
+{
+    const Options& options = impl->options;
+    prepare_output(impl->output, html, options);
+    impl->sink.set_target(impl->output);
+    impl->sink.set_max_output(options.max_output);
+    if(impl->transform_parser.has_value() == false)
+        impl->transform_parser.emplace(impl->emitter, options, impl->output.get_allocator().resource());
+    MinimizerTransformParser& transformer = *impl->transform_parser;
+    transformer.handler.set_transforms(transforms);
+    impl->emitter.reset();
+    transformer.parser.reset();
+    transformer.parser.parse(html, true);
+    transformer.parser.finish();
+    return impl->output;
+}
+
+void Minimizer::nanoize(const std::string_view html, std::string& out)
+{
+    prepare_output(out, html, impl->options);
+    if(impl->string_output.has_value() == false)
+        impl->string_output.emplace(out, impl->options, impl->output.get_allocator().resource());
+    MinimizerStringOutput& writer = *impl->string_output;
+    writer.sink.set_target(out);
+    run_minimizer(html, writer.sink, writer.emitter, writer.parser, impl->tree, impl->options);
+}
+
+void Minimizer::nanoize(const std::string_view html, std::pmr::string& out)
+{
+    prepare_output(out, html, impl->options);
+    // The minimizer's own writer, pointed back at its buffer by the overloads that return it
+    impl->sink.set_target(out);
+    run_minimizer(html, impl->sink, impl->emitter, impl->parser, impl->tree, impl->options);
+}
+
+const Options& Minimizer::options() const
+{
+    return impl->options;
 }
@@ -2,12 +2,409 @@
 
 #include <string>
 #include <string_view>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <functional>
+#include <iterator>
+#include <algorithm>
+#include <span>
+#include <chrono>
+#include <stdexcept>
 
 namespace nanoizepp {
+enum class Engine
+{
+    // Write the output directly while tokenizing, only keeping the stack of open elements
+    SinglePass,
+    // Build a full DOM tree, then serialize it
+    Tree
+};
+
+struct Options
+{
+    size_t indent = 0;
+    bool newline = false;
+    Engine engine = Engine::SinglePass;
+    // Threads used to minimize one large document (single pass engine only). 1 disables parallel minimization,
+    // 0 uses one thread per hardware thread. Small documents are always minimized on the calling thread
+    size_t threads = 1;
+    // Minify the CSS of <style> elements and style attributes: comments, whitespace, last semicolons of blocks, units
+    // of zero lengths and colors that have a shorter form
+    bool minify_css = false;
+    // Remove comments and whitespace from inline JavaScript, keeping the line breaks semicolon insertion may need,
+    // and whitespace from JSON script blocks. Scripts of other types or that cannot be tokenized are left alone
+    bool minify_js = false;
+    // Shorten attributes without changing what they do: boolean attributes without a value, values without quotes
+    // where HTML allows it, single spaces between class names and no default values like `method="get"`
+    bool minify_attributes = false;
+    // Write character references in text and attribute values in their shortest safe form, most of them as the
+    // UTF-8 character itself: `&nbsp;` becomes U+00A0, `&#x3C;` becomes `&lt;`. The output must be served as UTF-8
+    bool minify_entities = false;
+    // Set by nanoize_template(), which replaces placeholders by markers before minimizing: text and attribute values
+    // that contain a marker are written as they are
+    bool placeholder_markers = false;
+    // Limits for untrusted documents, 0 for none. Exceeding one throws LimitExceeded, so the memory and time spent on
+    // a document stay bounded whatever it contains. Documents with a limit are minimized on the calling thread.
+    // max_depth counts elements open at the same time, max_nodes elements and text nodes, max_output bytes of output
+    size_t max_depth = 0;
+    size_t max_nodes = 0;
+    size_t max_output = 0;
+    // Past max_depth, close the innermost element before opening another one, the way browsers flatten deep
+    // documents, instead of throwing
+    bool flatten_deep_nesting = false;
+};
+
+/**
+ * @brief The limits of Options a document can exceed
+*/
+enum class Limit
+{
+    Depth,
+    Nodes,
+    Output
+};
+
+/**
+ * @brief Thrown when a document exceeds Options::max_depth, Options::max_nodes or Options::max_output. Output
+ * written before, into a caller-owned buffer or a callback, is incomplete
+*/
+class LimitExceeded : public std::runtime_error
+{
+public:
+    LimitExceeded(Limit limit, const char* message) : std::runtime_error(message), exceeded(limit) {}
+
+    Limit limit() const noexcept { return exceeded; }
+
+private:
+    Limit exceeded;
+};
+
 /**
  * @brief Miniaturize HTML
  * @param html HTML to miniaturize
  * @return Miniaturized HTML
 */
 std::string nanoize(std::string_view html, size_t indent = 0, bool newline = false);
-}
\ No newline at end of file
+
+/**
+ * @brief Miniaturize HTML
+ * @param html HTML to miniaturize
+ * @param options Output format and engine selection. All engines produce identical output
+ * @return Miniaturized HTML
+*/
+std::string nanoize(std::string_view html, const Options& options);
+
+/**
+ * @brief Miniaturize HTML into a caller-owned buffer. The previous content of `out` is replaced but its capacity is
+ * kept, so reusing the same buffer across documents avoids reallocating
+*/
+void nanoize(std::string_view html, std::string& out, const Options& options = {});
+
+/**
+ * @brief Miniaturize HTML into a caller-owned buffer. The previous content of `out` is replaced
+*/
+void nanoize(std::string_view html, std::vector<char>& out, const Options& options = {});
+
+/**
+ * @brief Miniaturize HTML into a string using a memory resource. The parser's scratch memory comes from `resource`
+ * as well, so a request can be backed by a std::pmr::monotonic_buffer_resource and dropped all at once
+*/
+std::pmr::string nanoize(std::string_view html, std::pmr::memory_resource* resource, const Options& options = {});
+
+/**
+ * @brief Miniaturize HTML into a caller-owned buffer. The previous content of `out` is replaced. Scratch memory is
+ * taken from the memory resource of `out`
+*/
+void nanoize(std::string_view html, std::pmr::string& out, const Options& options = {});
+
+/**
+ * @brief Opening and closing delimiters of a template placeholder, like `{{` and `}}`
+*/
+struct Placeholder
+{
+    std::string_view open;
+    std::string_view close;
+};
+
+// Jinja, Django, Twig, Liquid and alike (`{{ }}`, `{% %}`, `{# #}`), ERB, EJS, JSP and Drogon CSP (`<% %>`, `[[ ]]`)
+inline constexpr Placeholder default_placeholders[] = {
+    {"{{", "}}"}, {"{%", "%}"}, {"{#", "#}"}, {"<%", "%>"}, {"[[", "]]"},
+};
+
+/**
+ * @brief Miniaturize a template, so that it is minimized once at build time instead of every page it renders
+ *
+ * A placeholder runs from an opening delimiter to the first closing delimiter of the same pair after it, and is
+ * kept byte for byte wherever it is: in text, in attribute values, in place of attributes or tag names, in scripts
+ * and styles. Text next to a placeholder is kept with its whitespace collapsed, never dropped. Attribute values that
+ * contain one keep their quotes, and the text of scripts and styles that contain one is not minified. Everything
+ * else is minimized like nanoize() does. The markup has to make sense with the placeholders taken out: elements
+ * opened in both branches of a conditional look like two elements to the parser.
+ *
+ * @param placeholders Delimiters to look for. Where several opening delimiters match, the longest one wins
+ * @throws std::runtime_error If a placeholder is not closed, a delimiter is empty or the template contains the
+ * character U+001A (used internally)
+*/
+std::string nanoize_template(std::string_view html, const Options& options = {},
+    std::span<const Placeholder> placeholders = default_placeholders);
+
+/**
+ * @brief What happened while minimizing one document, see nanoize(html, out, options, stats)
+*/
+struct DocumentStats
+{
+    size_t input_bytes = 0;
+    size_t output_bytes = 0;
+    // Elements written, void and raw text elements included
+    size_t elements = 0;
+    size_t attributes = 0;
+    size_t text_nodes = 0;
+    // Comments, processing instructions and bogus comments (`<!x>`) dropped
+    size_t comments_removed = 0;
+    // CDATA sections dropped because they are outside of <svg> and <math>
+    size_t cdata_removed = 0;
+    // Bytes of text removed by collapsing whitespace runs and dropping whitespace between tags
+    size_t whitespace_removed = 0;
+    // Elements closed without an end tag of their own: by the end tag of an ancestor, by a heading of another level
+    // or by the end of the document
+    size_t implied_end_tags = 0;
+    // End tags that matched no open element and were dropped
+    size_t ignored_end_tags = 0;
+    // Allocations of parser scratch memory, plus one if the output buffer had to grow
+    size_t allocations = 0;
+    // Tree engine: building the tree. Single pass engine: everything, parsing and writing are interleaved
+    std::chrono::nanoseconds parse_time{0};
+    // Tree engine only: writing the tree
+    std::chrono::nanoseconds serialize_time{0};
+    std::chrono::nanoseconds total_time{0};
+};
+
+/**
+ * @brief Miniaturize HTML into a caller-owned buffer and report what was done to the document
+ *
+ * Collecting statistics costs a little time, other overloads do not collect anything. Documents are always
+ * minimized on the calling thread (`options.threads` is ignored) so the counts and timings are comparable.
+*/
+void nanoize(std::string_view html, std::string& out, const Options& options, DocumentStats& stats);
+
+/**
+ * @brief Miniaturize HTML and pass the output to `callback` in blocks as it is produced
+*/
+void nanoize(std::string_view html, const std::function<void(std::string_view)>& callback, const Options& options = {});
+
+/**
+ * @brief Miniaturize HTML and write the output through an output iterator
+ * @return The iterator past the last written character
+*/
+template <std::output_iterator<char> OutputIt>
+OutputIt nanoize(std::string_view html, OutputIt out, const Options& options = {})
+{
+    nanoize(html, std::function<void(std::string_view)>([&](std::string_view block) {
+        out = std::copy(block.begin(), block.end(), out);
+    }), options);
+    return out;
+}
+
+class Transform;
+
+/**
+ * @brief Reusable minimization context for a long-lived thread
+ *
+ * Keeps the parser's scratch buffers, the tree engine's node memory and an output buffer from one document to the
+ * next. Once it has seen documents of a similar size and shape, minimizing another one does not allocate (parallel
+ * minimization of large documents, enabled by `Options::threads`, still does). Not thread-safe, use one per thread.
+*/
+class Minimizer
+{
+public:
+    /**
+     * @param resource Allocates all memory kept by the minimizer
+    */
+    explicit Minimizer(const Options& options = {}, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    ~Minimizer();
+    Minimizer(Minimizer&&) noexcept;
+    Minimizer& operator=(Minimizer&&) noexcept;
+
+    /**
+     * @brief Miniaturize HTML into the minimizer's own buffer
+     * @return The minimized HTML, valid until the next call
+    */
+    std::string_view nanoize(std::string_view html);
+
+    /**
+     * @brief Miniaturize HTML into a caller-owned buffer. The previous content of `out` is replaced but its capacity
+     * is kept
+    */
+    void nanoize(std::string_view html, std::string& out);
+    void nanoize(std::string_view html, std::pmr::string& out);
+
+    /**
+     * @brief Miniaturize HTML into the minimizer's own buffer and fill in `stats`, see
+     * nanoize(html, out, options, stats)
+    */
+    std::string_view nanoize(std::string_view html, DocumentStats& stats);
+
+    /**
+     * @brief Miniaturize HTML into the minimizer's own buffer, running `transforms` (see transform.hpp) on every
+     * element in the same pass. Uses the single pass engine whatever the options
+     * @return The minimized HTML, valid until the next call
+    */
+    std::string_view nanoize(std::string_view html, std::span<Transform* const> transforms);
+
+    const Options& options() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * @brief Totals of a nanoize_batch() call
+*/
+struct BatchStats
+{
+    size_t documents = 0;
+    size_t input_bytes = 0;
+    size_t output_bytes = 0;
+    std::chrono::nanoseconds elapsed{0};
+    // Threads that took part, the calling thread included
+    size_t threads = 0;
+};
+
+/**
+ * @brief Miniaturize many documents on a thread pool
+ *
+ * Documents are handed out largest first and idle threads steal work from busy ones, so a single huge document
+ * does not hold up the rest of the batch. Each document is minimized on one thread (`options.threads` is ignored),
+ * by a Minimizer that thread keeps for the whole batch. If a document throws, the remaining ones are skipped and the
+ * exception is rethrown.
+ *
+ * @param outputs Receives the minimized documents, one per input. Capacity is kept as with nanoize(html, out)
+ * @param threads Threads to use, the calling thread included. 0 uses one per hardware thread
+*/
+BatchStats nanoize_batch(std::span<const std::string_view> documents, std::span<std::string> outputs,
+    const Options& options = {}, size_t threads = 0);
+
+/**
+ * @brief Miniaturize many documents on a thread pool and pass each result to `callback` as soon as it is ready
+ *
+ * `callback(index, output)` is called from the worker threads, possibly concurrently and in any order. `output`
+ * lives in a per-thread buffer that is reused for the next document, so it is only valid during the call.
+*/
+BatchStats nanoize_batch(std::span<const std::string_view> documents,
+    const std::function<void(size_t, std::string_view)>& callback, const Options& options = {}, size_t threads = 0);
+
+/**
+ * @brief Miniaturize many documents on a thread pool
+ * @return The minimized documents, in the same order as the input
+*/
+std::vector<std::string> nanoize_batch(std::span<const std::string_view> documents, const Options& options = {},
+    size_t threads = 0);
+
+/**
+ * @brief Counters of a NanoizeCache
+*/
+struct CacheStats
+{
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t entries = 0;
+    // Bytes of minimized output held by the cache, not counting the copies of the documents
+    size_t bytes = 0;
+};
+
+/**
+ * @brief Thread-safe cache of minimized documents, keyed by a 128 bit hash of the input and the output options
+ *
+ * Pages that are rendered again and again (the same article, the same partials) are only minimized once. The cache
+ * holds at most `max_bytes` of output, split into independently locked shards that each evict with the CLOCK
+ * algorithm, so lookups from many threads rarely wait on each other. Results are shared immutable buffers: a hit
+ * does not copy, and an evicted result stays valid for as long as someone holds on to it.
+ *
+ * Documents are found by a hash seeded differently in every process, and each entry keeps a copy of its document
+ * that a hit is compared with, so a document can never get the output of another one, even one crafted to collide.
+ *
+ * An entry is never split across shards: documents whose size plus the size of their output is larger than
+ * `max_bytes` divided by the number of shards (minus about 128 bytes of bookkeeping) are minimized but not cached.
+ * The number of shards is reduced so that each gets at least 1 MiB of the budget, or all of it in caches smaller
+ * than that, so a document and its output always fit if they take 1 MiB together.
+*/
+class NanoizeCache
+{
+public:
+    /**
+     * @param max_bytes Budget for cached output and documents (plus a small per-entry overhead)
+     * @param shards Number of shards, 0 picks one based on the number of hardware threads. Rounded up to a power of
+     * two, and capped so that every shard gets at least 1 MiB
+    */
+    explicit NanoizeCache(size_t max_bytes, size_t shards = 0);
+    ~NanoizeCache();
+    NanoizeCache(NanoizeCache&&) noexcept;
+    NanoizeCache& operator=(NanoizeCache&&) noexcept;
+
+    /**
+     * @brief Get the minimized `html`, minimizing it and adding it to the cache on a miss. The limits of `options`
+     * apply to hits too: outputs cached without them are not returned past them
+    */
+    std::shared_ptr<const std::string> nanoize(std::string_view html, const Options& options = {});
+
+    /**
+     * @brief Get the minimized `html` if it is cached, nullptr otherwise. Does not count as a hit or a miss. Like
+     * nanoize(), throws LimitExceeded if the cached output is larger than `options.max_output`
+    */
+    std::shared_ptr<const std::string> find(std::string_view html, const Options& options = {}) const;
+
+    CacheStats stats() const;
+
+    /**
+     * @brief Drop every entry. Counters are kept
+    */
+    void clear();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+
+/**
+ * @brief Miniaturize HTML that arrives in chunks (ex: a chunked HTTP response body)
+ *
+ * Feed the document piece by piece and send out whatever is returned. Constructs split across chunks (tags,
+ * comments, raw text, CDATA) are held back until they are complete, so only the longest unfinished construct is
+ * buffered. The concatenated output is identical to nanoize() on the whole document.
+ *
+ * An unfinished construct longer than 1 KiB is only retried once the buffered input has doubled, so the total work
+ * stays linear in the size of the document however it is chunked, at the cost of holding output back by up to that
+ * much input.
+*/
+class StreamNanoizer
+{
+public:
+    StreamNanoizer(size_t indent = 0, bool newline = false);
+    /**
+     * @param options Output options, the engine and thread count are ignored
+    */
+    explicit StreamNanoizer(const Options& options);
+    ~StreamNanoizer();
+    StreamNanoizer(StreamNanoizer&&) noexcept;
+    StreamNanoizer& operator=(StreamNanoizer&&) noexcept;
+
+    /**
+     * @brief Feed the next chunk of the document
+     * @return Miniaturized HTML that is ready to be sent
+    */
+    std::string feed(std::string_view chunk);
+
+    /**
+     * @brief Signal the end of the document
+     * @return The remaining miniaturized HTML
+    */
+    std::string finish();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl;
+};
+}
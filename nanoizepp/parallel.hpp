@@ -0,0 +1,264 @@
+#pragma once
+
+#include "parser.hpp"
+#include "emitter.hpp"
+#include "sink.hpp"
+#include "arena.hpp"
+#include "thread_pool.hpp"
+
+#include <exception>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * Parallel minimization of a single document.
+ *
+ * 1. The document is cut into segments at '<' characters that look like the start of a tag. Each segment is
+ *    tokenized on its own thread, with the rest of the document as lookahead. Tokenizing does not depend on the open
+ *    elements, so this produces exactly the tokens of the sequential tokenizer if the cut is at a token boundary.
+ * 2. The cuts are validated in order: a segment is only kept if the previous one ended exactly where it starts.
+ *    A cut that landed inside a comment, a tag, raw text or CDATA is detected here and the segment is tokenized
+ *    again from the right position. The tokens are then run through a TreeConstruction that produces no output, to
+ *    learn the open elements at the start of every segment.
+ * 3. Each segment is serialized on its own thread by a TreeConstruction that starts from those open elements, and
+ *    the pieces are concatenated.
+ *
+ * The output is byte-identical to the single pass engine.
+*/
+
+// Segments smaller than this are not worth the overhead
+inline constexpr size_t min_parallel_segment_size = 256 * 1024;
+
+enum class TokenKind : uint8_t
+{
+    StartTag,
+    VoidElement,
+    RawElement,
+    EndTag,
+    Text,
+    Cdata
+};
+
+struct Token
+{
+    TokenKind kind;
+    Tag tag;
+    std::string_view text;
+    std::span<const Attribute> attributes;
+};
+
+struct Segment
+{
+    // Where tokenizing starts and the cut it should end at
+    size_t begin = 0;
+    size_t limit = 0;
+    // Where tokenizing actually ended
+    size_t end = 0;
+    std::vector<Token> tokens;
+    // Copies of transient text and attribute lists
+    Arena storage{4096};
+    std::exception_ptr error;
+    // Elements open when the segment starts
+    std::vector<Tag> open_elements;
+    std::string output;
+};
+
+/**
+ * @brief Tokenizer handler recording the tokens of one segment
+*/
+class TokenRecorder
+{
+public:
+    explicit TokenRecorder(Segment& segment) : segment(segment) {}
+
+    void start_tag(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        segment.tokens.push_back({TokenKind::StartTag, tag, {}, segment.storage.copy(attributes)});
+    }
+
+    void void_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        segment.tokens.push_back({TokenKind::VoidElement, tag, {}, segment.storage.copy(attributes)});
+    }
+
+    void raw_element(const Tag tag, const std::span<const Attribute> attributes, const std::string_view text)
+    {
+        segment.tokens.push_back({TokenKind::RawElement, tag, text, segment.storage.copy(attributes)});
+    }
+
+    void end_tag(const Tag tag)
+    {
+        segment.tokens.push_back({TokenKind::EndTag, tag, {}, {}});
+    }
+
+    void text(const std::string_view text)
+    {
+        segment.tokens.push_back({TokenKind::Text, {}, segment.storage.copy(text), {}});
+    }
+
+    void cdata(const std::string_view text)
+    {
+        segment.tokens.push_back({TokenKind::Cdata, {}, segment.storage.copy(text), {}});
+    }
+
+private:
+    Segment& segment;
+};
+
+/**
+ * @brief TreeConstruction handler that ignores the document, used to only track the open elements
+*/
+struct NullHandler
+{
+    void open(Tag, std::span<const Attribute>) {}
+    void void_element(Tag, std::span<const Attribute>) {}
+    void text(std::string_view) {}
+    void raw_text(std::string_view) {}
+    void close(Tag) {}
+};
+
+inline void tokenize_segment(const std::string_view html, Segment& segment)
+{
+    segment.tokens.clear();
+    segment.tokens.reserve((segment.limit - segment.begin) / 32);
+    segment.error = nullptr;
+    TokenRecorder recorder(segment);
+    Tokenizer<TokenRecorder> tokenizer(recorder);
+    try {
+        segment.end = segment.begin + tokenizer.parse(html.substr(segment.begin), true, segment.limit - segment.begin);
+    }
+    catch(...) {
+        // Only an error if the segment turns out to start at a real token boundary
+        segment.error = std::current_exception();
+        segment.end = html.size();
+    }
+}
+
+template <typename Handler>
+void replay_tokens(const std::span<const Token> tokens, TreeConstruction<Handler>& tree)
+{
+    for(const Token& token : tokens) {
+        switch(token.kind) {
+        case TokenKind::StartTag: tree.start_tag(token.tag, token.attributes); break;
+        case TokenKind::VoidElement: tree.void_element(token.tag, token.attributes); break;
+        case TokenKind::RawElement: tree.raw_element(token.tag, token.attributes, token.text); break;
+        case TokenKind::EndTag: tree.end_tag(token.tag); break;
+        case TokenKind::Text: tree.text(token.text); break;
+        case TokenKind::Cdata: tree.cdata(token.text); break;
+        }
+    }
+}
+
+/**
+ * @brief Give every unknown element in `tokens` its id, so segments can be serialized without sharing an interner
+*/
+inline void intern_tags(std::vector<Token>& tokens, TagInterner& tags)
+{
+    for(Token& token : tokens) {
+        if(token.tag.id != 0 || token.tag.name.empty())
+            continue;
+        if(token.kind == TokenKind::StartTag)
+            token.tag = tags.intern(token.tag.name);
+        else if(token.kind == TokenKind::EndTag)
+            token.tag = tags.find(token.tag.name);
+    }
+}
+
+/**
+ * @brief Cut `html` into about `count` segments, each starting at a '<' followed by a letter or '/'
+*/
+inline std::vector<size_t> find_split_points(const std::string_view html, size_t count)
+{
+    std::vector<size_t> points{0};
+    for(size_t i = 1; i < count; i++) {
+        size_t pos = std::max(html.size() * i / count, points.back() + 1);
+        while((pos = html.find('<', pos)) != std::string_view::npos) {
+            if(pos + 1 < html.size() && (std::isalpha((unsigned char)html[pos + 1]) || html[pos + 1] == '/'))
+                break;
+            pos++;
+        }
+        if(pos == std::string_view::npos)
+            break;
+        points.push_back(pos);
+    }
+    return points;
+}
+
+template <typename Sink>
+void nanoize_parallel(const std::string_view html, Sink& out, const Options& options, size_t threads)
+{
+    auto& pool = ThreadPool::shared();
+    // A few segments per thread so threads that finish early can pick up more work
+    size_t segment_count = std::min(threads * 4, html.size() / min_parallel_segment_size);
+    auto points = find_split_points(html, std::max<size_t>(segment_count, 1));
+    std::vector<Segment> segments(points.size());
+    for(size_t i = 0; i < points.size(); i++) {
+        segments[i].begin = points[i];
+        segments[i].limit = i + 1 < points.size() ? points[i + 1] : html.size();
+    }
+
+    pool.parallel_for(segments.size(), threads, [&](size_t i, size_t) {
+        tokenize_segment(html, segments[i]);
+    });
+
+    // Validate the cuts and track the open elements, in document order
+    TagInterner tags;
+    NullHandler null_handler;
+    TreeConstruction<NullHandler> tracker(null_handler);
+    size_t position = 0;
+    size_t saved_elements = 0;
+    for(auto& segment : segments) {
+        if(segment.begin != position) {
+            // The previous segment ran past this cut (it was inside a comment, raw text...)
+            if(position >= segment.limit) {
+                segment.begin = segment.end = position;
+                segment.tokens.clear();
+                segment.error = nullptr;
+            }
+            else {
+                segment.begin = position;
+                tokenize_segment(html, segment);
+            }
+        }
+        if(segment.error)
+            std::rethrow_exception(segment.error);
+        intern_tags(segment.tokens, tags);
+        auto open_elements = tracker.open_elements();
+        segment.open_elements.assign(open_elements.begin(), open_elements.end());
+        saved_elements += open_elements.size();
+        replay_tokens<NullHandler>(segment.tokens, tracker);
+        position = segment.end;
+    }
+
+    // Very deep documents would need a copy of a huge stack for every segment, serialize those on this thread
+    if(saved_elements > html.size() / 32) {
+        Emitter<Sink> emitter(out, options);
+        TreeConstruction<Emitter<Sink>> tree(emitter);
+        for(const auto& segment : segments)
+            replay_tokens<Emitter<Sink>>(segment.tokens, tree);
+        tree.finish();
+        return;
+    }
+
+    pool.parallel_for(segments.size(), threads, [&](size_t i, size_t) {
+        auto& segment = segments[i];
+        segment.output.reserve(estimate_output_size(html.substr(segment.begin, segment.end - segment.begin),
+            options.indent, options.newline));
+        StringSink sink(segment.output);
+        Emitter<StringSink> emitter(sink, options, segment.open_elements.size());
+        TreeConstruction<Emitter<StringSink>> tree(emitter);
+        tree.set_open_elements(segment.open_elements);
+        replay_tokens<Emitter<StringSink>>(segment.tokens, tree);
+        if(i + 1 == segments.size())
+            tree.finish();
+    });
+    for(const auto& segment : segments)
+        out.append(segment.output);
+}
+
+}
@@ -0,0 +1,1006 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory_resource>
+#include <string_view>
+#include <span>
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <cstdint>
+#include <utility>
+
+#include "nanoizepp.hpp"
+#include "hash.hpp"
+#include "scan.hpp"
+#include "stats.hpp"
+#include "tags.hpp"
+
+namespace nanoizepp::detail
+{
+
+inline constexpr CharSet whitespace_or_solidus(" \t\n\r/");
+inline constexpr CharSet attribute_name_end_chars(" \t\n\r=>");
+inline constexpr CharSet unquoted_value_end_chars(" \t\n\r>");
+inline constexpr CharSet tag_name_end_chars(" \t\n\r>[");
+inline constexpr CharSet end_tag_name_end_chars(" \t\n\r\f/>");
+inline constexpr CharSet less_than_char("<");
+
+struct Attribute
+{
+    std::string_view name;
+    std::string_view value;
+    // The quote character the value was written with, 0 if it was not quoted
+    char quote = 0;
+};
+
+/**
+ * @brief Allocator of the parser's scratch buffers. Memory comes from a memory resource, or from operator new when
+ * there is none and during constant evaluation, where memory resources cannot be used (see static_html.hpp)
+*/
+template <typename T>
+class ScratchAllocator
+{
+public:
+    using value_type = T;
+
+    constexpr ScratchAllocator(std::pmr::memory_resource* resource = nullptr) noexcept : resource(resource) {}
+
+    template <typename U>
+    constexpr ScratchAllocator(const ScratchAllocator<U>& other) noexcept : resource(other.resource)
+    {
+    }
+
+    constexpr T* allocate(size_t count)
+    {
+        if(std::is_constant_evaluated() || resource == nullptr)
+            return std::allocator<T>().allocate(count);
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    constexpr void deallocate(T* p, size_t count)
+    {
+        if(std::is_constant_evaluated() || resource == nullptr)
+            std::allocator<T>().deallocate(p, count);
+        else
+            resource->deallocate(p, count * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    constexpr bool operator==(const ScratchAllocator<U>& other) const { return resource == other.resource; }
+
+private:
+    template <typename U>
+    friend class ScratchAllocator;
+
+    std::pmr::memory_resource* resource;
+};
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+using ScratchString = std::basic_string<char, std::char_traits<char>, ScratchAllocator<char>>;
+
+// Attributes in the order they appear in the tag. Duplicates are dropped by the parser
+using Attributes = ScratchVector<Attribute>;
+
+/**
+ * @brief Collapse whitespace runs into a single space and replace NUL characters with U+FFFD
+ * @param sv Text to minimize
+ * @param minimized_text String to append the minimized text to
+*/
+template <typename String>
+constexpr void minimize_html_text(const std::string_view text, String& minimized_text)
+{
+    // Start of the part of `text` not copied yet
+    size_t start = 0;
+    while(start < text.size()) {
+        auto rewrite = scan_text_rewrite(text.substr(start));
+        if(rewrite == std::string_view::npos)
+            break;
+        rewrite += start;
+        minimized_text += text.substr(start, rewrite - start);
+        // replace NUL characters with U+FFFD
+        if(text[rewrite] == '\0') {
+            minimized_text += "\xEF\xBF\xBD";
+            start = rewrite + 1;
+            continue;
+        }
+        minimized_text += ' ';
+        auto non_space = scan_first_not_of(text.substr(rewrite), whitespace_chars);
+        start = non_space == std::string_view::npos ? text.size() : rewrite + non_space;
+    }
+    if(start < text.size())
+        minimized_text += text.substr(start);
+}
+
+struct ParsedAttributes
+{
+    std::string_view remaining;
+    // true if parsing stopped at the closing '>' of the tag
+    bool closed = false;
+};
+
+constexpr bool has_attribute(const Attributes& attributes, const std::string_view name)
+{
+    return std::any_of(attributes.begin(), attributes.end(), [&](const Attribute& attribute) {
+        return attribute.name == name;
+    });
+}
+
+/**
+ * @brief Finds repeated attribute names in a tag. A few attributes are compared directly, tags with more go through
+ * a hash table so that a tag with thousands of attributes is still parsed in linear time. The hash is seeded per
+ * process, crafted names cannot force collisions.
+*/
+class DuplicateAttributeFilter
+{
+public:
+    constexpr explicit DuplicateAttributeFilter(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : slots(resource)
+    {
+    }
+
+    /**
+     * @brief Start a new tag
+    */
+    constexpr void clear()
+    {
+        hashed = false;
+    }
+
+    /**
+     * @brief true if `name` is already in `attributes`. If not, it is remembered as the next attribute, the caller
+     * has to add it
+    */
+    constexpr bool contains(const Attributes& attributes, const std::string_view name)
+    {
+        if(hashed == false) {
+            // The hash cannot be computed during constant evaluation, literals have few attributes anyway
+            if(attributes.size() < max_compared_attributes || std::is_constant_evaluated())
+                return has_attribute(attributes, name);
+            rebuild(attributes, max_compared_attributes * 4);
+        }
+        size_t slot = find_slot(attributes, name);
+        if(slots[slot] != 0)
+            return true;
+        slots[slot] = uint32_t(attributes.size() + 1);
+        if(++used * 2 > slots.size())
+            rebuild(attributes, slots.size() * 2, name);
+        return false;
+    }
+
+private:
+    static constexpr size_t max_compared_attributes = 16;
+
+    static uint64_t hash(const std::string_view name)
+    {
+        return hash128(name, process_seed()).low;
+    }
+
+    /**
+     * @return The slot holding `name`, or the empty slot where it belongs
+    */
+    size_t find_slot(const Attributes& attributes, const std::string_view name) const
+    {
+        size_t mask = slots.size() - 1;
+        size_t slot = hash(name) & mask;
+        while(slots[slot] != 0 && attributes[slots[slot] - 1].name != name)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    /**
+     * @brief Fill a table of `size` slots with the names in `attributes`, plus `pending` (about to be added)
+    */
+    void rebuild(const Attributes& attributes, size_t size, const std::string_view pending = {})
+    {
+        slots.assign(size, 0);
+        used = 0;
+        hashed = true;
+        for(size_t i = 0; i < attributes.size(); i++) {
+            slots[find_slot(attributes, attributes[i].name)] = uint32_t(i + 1);
+            used++;
+        }
+        if(pending.data() != nullptr) {
+            size_t mask = slots.size() - 1;
+            size_t slot = hash(pending) & mask;
+            while(slots[slot] != 0)
+                slot = (slot + 1) & mask;
+            slots[slot] = uint32_t(attributes.size() + 1);
+            used++;
+        }
+    }
+
+    // Index + 1 of the attribute in each slot, 0 for empty slots
+    ScratchVector<uint32_t> slots;
+    size_t used = 0;
+    bool hashed = false;
+};
+
+/**
+ * @brief Find the end tag of a raw text element the way browsers do: `</` and the name in any case, followed by
+ * `>`, `/` or whitespace, up to the next `>` (ex: `</SCRIPT >`)
+ * @return Position and size of the end tag, npos if there is none
+*/
+constexpr std::pair<size_t, size_t> find_end_tag(const std::string_view html, const std::string_view tag)
+{
+    size_t pos = 0;
+    while(true) {
+        auto less_than = scan_first_of(html.substr(pos), less_than_char);
+        if(less_than == std::string_view::npos)
+            break;
+        pos += less_than;
+        auto candidate = html.substr(pos + 1);
+        if(candidate.size() > tag.size() + 1 && candidate[0] == '/'
+            && end_tag_name_end_chars.contains(candidate[tag.size() + 1])
+            && equals_ignore_case(candidate.substr(1, tag.size()), tag)) {
+            // Anything between the name and the `>` is ignored like the attributes of an end tag
+            auto end = candidate.find('>', tag.size() + 1);
+            if(end == std::string_view::npos)
+                break;
+            return {pos, end + 2};
+        }
+        pos++;
+    }
+    return {std::string_view::npos, 0};
+}
+
+/**
+ * @brief Find the end of a comment, the first `-->` or `--!>`, in one pass over the text
+ * @return Position and size of the end marker, npos if there is none
+*/
+constexpr std::pair<size_t, size_t> find_comment_end(const std::string_view comment)
+{
+    for(size_t pos = comment.find("--"); pos != std::string_view::npos; pos = comment.find("--", pos + 1)) {
+        if(pos + 2 < comment.size() && comment[pos + 2] == '>')
+            return {pos, 3};
+        if(pos + 3 < comment.size() && comment[pos + 2] == '!' && comment[pos + 3] == '>')
+            return {pos, 4};
+    }
+    return {std::string_view::npos, 0};
+}
+
+/**
+ * @brief Parse attributes from a tag without the tag name
+ * @param sv String to parse attributes from ex: " id=\"test\" class=\"test\"> ..."
+ * @param attributes Receives the attributes (an Attributes or another vector of Attribute). Names and values point
+ * into `sv`
+ * @param duplicates Drops repeated attributes, the first one wins (a DuplicateAttributeFilter)
+*/
+template <typename AttributeList, typename DuplicateFilter>
+constexpr ParsedAttributes parse_attributes(const std::string_view sv, AttributeList& attributes,
+    DuplicateFilter& duplicates)
+{
+    attributes.clear();
+    duplicates.clear();
+    std::string_view remaining = sv;
+    while(remaining.empty() == false) {
+        // skip whitespaces and / (because HTML5 standard)
+        auto whitespace = scan_first_not_of(remaining, whitespace_or_solidus);
+        if(whitespace == std::string_view::npos) {
+            remaining = std::string_view();
+            break;
+        }
+        remaining = remaining.substr(whitespace);
+        // check if we are at the end of the tag
+        if(remaining[0] == '>')
+            break;
+
+        // find the attribute name
+        auto attribute_name_end = scan_first_of(remaining, attribute_name_end_chars);
+        if(attribute_name_end == std::string_view::npos) {
+            remaining = std::string_view();
+            break;
+        }
+        auto attribute_name = remaining.substr(0, attribute_name_end);
+        remaining = remaining.substr(attribute_name_end);
+        // skip whitespaces
+        whitespace = scan_first_not_of(remaining, whitespace_chars);
+        if(whitespace == std::string_view::npos) {
+            remaining = std::string_view();
+            break;
+        }
+        // We expect an = here
+        if(remaining[whitespace] != '=') {
+            remaining = remaining.substr(whitespace);
+            if(duplicates.contains(attributes, attribute_name) == false)
+                attributes.push_back({attribute_name, {}});
+            continue;
+        }
+        remaining = remaining.substr(whitespace + 1);
+        // skip whitespaces
+        whitespace = scan_first_not_of(remaining, whitespace_chars);
+        if(whitespace == std::string_view::npos) {
+            remaining = std::string_view();
+            break;
+        }
+        remaining = remaining.substr(whitespace);
+        // check if we are at the end of the tag
+        if(remaining[0] == '>') {
+            if(duplicates.contains(attributes, attribute_name) == false)
+                attributes.push_back({attribute_name, {}});
+            break;
+        }
+        // now we should be at the start of the attribute value
+        std::string_view attribute_value;
+        const char quote = remaining[0];
+        if(quote != '"' && quote != '\'') {
+            // attribute value is not quoted, find the next whitespace
+            auto attribute_value_end = scan_first_of(remaining, unquoted_value_end_chars);
+            if(attribute_value_end == std::string_view::npos)
+                attribute_value_end = remaining.size();
+            attribute_value = remaining.substr(0, attribute_value_end);
+            remaining = remaining.substr(attribute_value_end);
+        }
+        else {
+            // attribute value is quoted, find the next quote
+            remaining = remaining.substr(1);
+            auto attribute_value_end = remaining.find(quote);
+            // pretend to have the quote at the end of the string
+            if(attribute_value_end == std::string_view::npos) {
+                attribute_value = remaining;
+                remaining = std::string_view();
+            }
+            else {
+                attribute_value = remaining.substr(0, attribute_value_end);
+                remaining = remaining.substr(attribute_value_end + 1);
+            }
+        }
+
+        if(duplicates.contains(attributes, attribute_name))
+            continue;
+        attributes.push_back({attribute_name, attribute_value, quote == '"' || quote == '\'' ? quote : '\0'});
+    }
+
+    bool closed = remaining.empty() == false && remaining[0] == '>';
+    if(closed)
+        remaining = remaining.substr(1);
+    return {remaining, closed};
+}
+
+/**
+ * @brief Splits HTML into tokens. Results are reported to the handler as start_tag(tag, attributes),
+ * void_element(tag, attributes), raw_element(tag, attributes, text), end_tag(tag), text(text) and cdata(text) calls
+ * in document order. Strings passed to text() and cdata() are only valid during the call, attributes and raw text
+ * point into the input given to parse(). Known elements are reported with their id and canonical name, anything
+ * else with id 0 and the name as written.
+ *
+ * Tokenizing does not depend on the elements that are open, so the tokenizer can start at any tag boundary.
+ *
+ * Dropped comments and removed whitespace are reported to the `Stats` policy (see stats.hpp).
+ *
+ * The tokenizer is resumable. parse() consumes as much of the input as it can and returns the number of bytes
+ * consumed. Unless `eof` is set, it stops in front of any construct (tag, comment, CDATA, raw text) that could
+ * continue past the end of the given input, so the caller can retry once more data is available.
+ *
+ * Parsing takes time linear in the size of the input, whatever the input: every scan (text, tags, attributes,
+ * comments, raw text, CDATA) moves forward only and stops at the first possible end of its construct, and duplicate
+ * attributes are found through a hash table in tags with many of them. Retrying after `eof == false` rescans the
+ * unfinished construct, callers that retry should wait for a growing amount of new input (see StreamNanoizer).
+*/
+template <typename Handler, typename Stats = NoStats>
+class Tokenizer
+{
+public:
+    /**
+     * @param resource Allocates the scratch buffers
+    */
+    constexpr explicit Tokenizer(Handler& handler,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : handler(handler), text_buffer(resource), attributes(resource), duplicates(resource)
+    {
+    }
+
+    /**
+     * @brief Start over with a new document, keeping the capacity of the scratch buffers
+    */
+    constexpr void reset()
+    {
+        stopped = false;
+        in_text_run = false;
+    }
+
+    /**
+     * @brief Allow text runs to be reported in several pieces when they are cut by the end of the input. Only
+     * safe when the handler concatenates adjacent text (no indentation or newlines).
+    */
+    constexpr void set_split_text(bool split) { split_text = split; }
+
+    constexpr void set_stats(const Stats& stats) { this->stats = stats; }
+
+    /**
+     * @param limit Stop after the first token that ends at or after `limit`, used to tokenize part of a document
+    */
+    constexpr size_t parse(const std::string_view html, bool eof, size_t limit = std::string_view::npos)
+    {
+        size_t consumed = 0;
+        limit = std::min(limit, html.size());
+        while(stopped == false && consumed < limit) {
+            std::string_view remaining_html = html.substr(consumed);
+            // skip whitespaces and see if we can find the start of a tag
+            auto whitespace = scan_first_not_of(remaining_html, whitespace_chars);
+            // Only speces and newlines left, we are done
+            if(whitespace == std::string_view::npos) {
+                if(eof == false)
+                    return consumed;
+                if(in_text_run)
+                    handler.text(" ");
+                stats.text(remaining_html.size(), in_text_run ? 1 : 0);
+                return stop(html);
+            }
+            // We found something, is it a start of a tag?
+            if(remaining_html[0] == '<') {
+                in_text_run = false;
+                // Need enough lookahead to tell comments, CDATA and DOCTYPE apart
+                if(eof == false && remaining_html.size() < 9)
+                    return consumed;
+                size_t tag_consumed = parse_tag(remaining_html.substr(1), eof);
+                if(tag_consumed == 0)
+                    return consumed;
+                consumed += tag_consumed + 1;
+            }
+            else {
+                auto text_end = remaining_html.find('<');
+                if(text_end == std::string_view::npos) {
+                    if(eof == false) {
+                        if(split_text == false)
+                            return consumed;
+                        // Emit up to the last non-space character. The trailing spaces may still be joined with
+                        // the next piece of the text run
+                        auto last = remaining_html.find_last_not_of(" \t\n\r");
+                        emit_text(remaining_html.substr(0, last + 1));
+                        in_text_run = true;
+                        consumed += last + 1;
+                        continue;
+                    }
+                    // no more tags, just text
+                    emit_text(remaining_html);
+                    return stop(html);
+                }
+                emit_text(remaining_html.substr(0, text_end));
+                in_text_run = false;
+                consumed += text_end;
+            }
+        }
+        if(stopped)
+            return html.size();
+        return consumed;
+    }
+
+    /**
+     * @brief true once the end of the document has been reached
+    */
+    constexpr bool done() const { return stopped; }
+
+private:
+    constexpr size_t stop(const std::string_view html)
+    {
+        stopped = true;
+        return html.size();
+    }
+
+    constexpr void emit_text(const std::string_view text)
+    {
+        text_buffer.clear();
+        minimize_html_text(text, text_buffer);
+        if(text_buffer.empty() || (text_buffer == " " && in_text_run == false)) {
+            stats.text(text.size(), 0);
+            return;
+        }
+        stats.text(text.size(), text_buffer.size());
+        handler.text(text_buffer);
+    }
+
+    /**
+     * @brief Parse the construct following a '<'
+     * @return Number of bytes consumed after the '<'. 0 if more input is needed
+    */
+    constexpr size_t parse_tag(const std::string_view sv, bool eof)
+    {
+        std::string_view remaining_html = sv;
+        auto consumed_until = [&](std::string_view rest) { return size_t(rest.data() - sv.data()); };
+        if(remaining_html.empty()) {
+            handler.text("<");
+            stopped = true;
+            return sv.size();
+        }
+
+        // Is it a comment?
+        if(remaining_html.size() >= 3 && remaining_html.starts_with("!--")) {
+            // check if it is `abrupt-closing-of-empty-comment` (<!-->)
+            auto comment = remaining_html.substr(3);
+            auto possibe_end = comment.find_first_not_of('-');
+            if(possibe_end == std::string_view::npos)
+                return skip_comment(need_more(sv, eof));
+            if(comment[possibe_end] == '>')
+                return skip_comment(consumed_until(comment.substr(possibe_end + 1)));
+
+            // It's not, let's try to find the end of the comment
+            auto [comment_end, end_size] = find_comment_end(remaining_html);
+            if(comment_end == std::string_view::npos)
+                return skip_comment(need_more(sv, eof));
+            return skip_comment(comment_end + end_size);
+        }
+        // Is possible to be a incorrectly-opened-comment?
+        if(remaining_html.size() >= 1 && remaining_html.starts_with("!")) {
+            // Is it really a incorrectly-opened-comment? Try by checking if the following character is
+            // not a [ (CDATA) or is DOCTYPE
+            if(remaining_html.starts_with("![CDATA[") == false
+                && equals_ignore_case(remaining_html.substr(0, 8), "!DOCTYPE") == false) {
+                // It is, let's try to find the end of the comment
+                auto comment_end = remaining_html.find('>');
+                if(comment_end == std::string_view::npos)
+                    return skip_comment(need_more(sv, eof));
+                return skip_comment(comment_end + 1);
+            }
+            // Else it's something else, let's just skip it
+        }
+
+        // find the actual tag name
+        auto tag_begin = scan_first_not_of(remaining_html, whitespace_chars);
+        if(tag_begin == std::string_view::npos) {
+            if(eof == false)
+                return 0;
+            handler.text("<");
+            stopped = true;
+            return sv.size();
+        }
+        remaining_html = remaining_html.substr(tag_begin);
+        auto tag_end = scan_first_of(remaining_html, tag_name_end_chars);
+        if(tag_end == std::string_view::npos) {
+            if(eof == false)
+                return 0;
+            text_buffer.assign(1, '<');
+            text_buffer.append(remaining_html);
+            handler.text(text_buffer);
+            stopped = true;
+            return sv.size();
+        }
+        // `<>` and `<[` do not start a tag, they are text
+        if(tag_end == 0) {
+            text_buffer.assign(1, '<');
+            text_buffer.push_back(remaining_html[0]);
+            handler.text(text_buffer);
+            return consumed_until(remaining_html.substr(1));
+        }
+        std::string_view tag_name = remaining_html.substr(0, tag_end);
+        remaining_html = remaining_html.substr(tag_end);
+        // Now, it's possible we met the </ div> tag, but we only parsed the </ part. But it's fine
+        // because of auto closing.
+
+        // Check if we got CDATA and handle it
+        if(tag_name == "!" && remaining_html.starts_with("[CDATA")) {
+            // CDATA
+            auto cdata_end = remaining_html.find("]]>");
+            if(cdata_end == std::string_view::npos && eof == false)
+                return 0;
+            // EOF in CDATA, the section extends to the end of the document
+            if(cdata_end == std::string_view::npos) {
+                cdata_end = remaining_html.size();
+                stopped = true;
+            }
+            std::string_view cdata = remaining_html.substr(std::min<size_t>(7, cdata_end), cdata_end - std::min<size_t>(7, cdata_end));
+
+            // Parsing CDATA is hard. Give up and just add it as a text node (if it is allowed where it is)
+            text_buffer.assign("<![CDATA[");
+            text_buffer.append(cdata);
+            text_buffer.append("]]>");
+            handler.cdata(text_buffer);
+            if(stopped)
+                return sv.size();
+            return consumed_until(remaining_html.substr(cdata_end + 3));
+        }
+
+        // parse attributes
+        auto [remaining, closed] = parse_attributes(remaining_html, attributes, duplicates);
+        if(closed == false && eof == false)
+            return 0;
+        remaining_html = remaining;
+
+        assert(tag_name.empty() == false);
+        // Is it a closing tag?
+        if(tag_name[0] == '/') {
+            tag_name.remove_prefix(1);
+            if(tag_name.ends_with('/'))
+                tag_name.remove_suffix(1);
+            if(tag_name.empty() == false)
+                handler.end_tag(make_tag(tag_name));
+            return consumed_until(remaining_html);
+        }
+
+        TagId known = find_known_tag(tag_name);
+        if(has_flag(known, TagFlags::Void)) {
+            if(known == doctype_tag && !(attributes.size() == 1 && equals_ignore_case(attributes[0].name, "html")
+                && attributes[0].value == ""))
+                throw std::runtime_error("Only HTML5 is supported by nanoizepp");
+            // The DOCTYPE is kept in its canonical `<!DOCTYPE html>` form
+            if(known == doctype_tag)
+                attributes[0].name = "html";
+
+            handler.void_element(Tag{known, known_tags[known].name}, attributes);
+            return consumed_until(remaining_html);
+        }
+
+        // Special handling for <script>, <pre>, <style> and alike
+        if(has_flag(known, TagFlags::RawText)) {
+            const Tag tag{known, known_tags[known].name};
+            auto [end_tag, end_tag_size] = find_end_tag(remaining_html, tag.name);
+            if(end_tag == std::string_view::npos) {
+                if(eof == false)
+                    return 0;
+                text_buffer.assign(1, '<');
+                text_buffer.append(tag_name);
+                handler.text(text_buffer);
+                stopped = true;
+                return sv.size();
+            }
+            handler.raw_element(tag, attributes, remaining_html.substr(0, end_tag));
+            return consumed_until(remaining_html.substr(end_tag + end_tag_size));
+        }
+        // is the tag valid?
+        if(tag_name[0] >= '0' && tag_name[0] <= '9') {
+            text_buffer.assign("&lt;");
+            text_buffer.append(tag_name);
+            text_buffer.append("&gt;");
+            handler.text(text_buffer);
+            return consumed_until(remaining_html);
+        }
+        if(tag_name[0] == '?')
+            return skip_comment(consumed_until(remaining_html));
+        if(tag_name.back() == '/') {
+            tag_name.remove_suffix(1);
+            // <br/> and alike
+            known = find_known_tag(tag_name);
+            if(has_flag(known, TagFlags::Void)) {
+                handler.void_element(Tag{known, known_tags[known].name}, attributes);
+                return consumed_until(remaining_html);
+            }
+        }
+        if(tag_name.empty() == false)
+            handler.start_tag(make_tag(tag_name), attributes);
+        return consumed_until(remaining_html);
+    }
+
+    static constexpr Tag make_tag(const std::string_view name)
+    {
+        TagId known = find_known_tag(name);
+        if(known != 0)
+            return {known, known_tags[known].name};
+        return {0, name};
+    }
+
+    /**
+     * @brief Count a comment that was skipped, unless nothing was consumed because more input is needed
+    */
+    constexpr size_t skip_comment(size_t consumed)
+    {
+        if(consumed != 0)
+            stats.comment();
+        return consumed;
+    }
+
+    constexpr size_t need_more(const std::string_view sv, bool eof)
+    {
+        if(eof == false)
+            return 0;
+        stopped = true;
+        return sv.size();
+    }
+
+    Handler& handler;
+    [[no_unique_address]] Stats stats;
+    // Reused for every text run to avoid an allocation per run
+    ScratchString text_buffer;
+    // Reused for every tag
+    Attributes attributes;
+    DuplicateAttributeFilter duplicates;
+    bool stopped = false;
+    bool split_text = false;
+    // The last text reported was cut by the end of the input and may continue
+    bool in_text_run = false;
+};
+
+/**
+ * @brief Limits on the document built by a TreeConstruction
+*/
+struct TreeLimits
+{
+    size_t max_depth = SIZE_MAX;
+    size_t max_nodes = SIZE_MAX;
+    // Past max_depth, close the innermost element instead of throwing
+    bool flatten = false;
+};
+
+constexpr TreeLimits tree_limits(const Options& options)
+{
+    return {options.max_depth == 0 ? SIZE_MAX : options.max_depth,
+        options.max_nodes == 0 ? SIZE_MAX : options.max_nodes, options.flatten_deep_nesting};
+}
+
+/**
+ * @brief Maintains the stack of open elements for a stream of tokens and reports the resulting document to the
+ * handler as open(tag, attributes), void_element(tag, attributes), text(text), raw_text(text) and close(tag)
+ * calls. Unknown elements are interned, so every Tag passed to the handler has an id and a lowercase name that
+ * stays valid for the lifetime of the TreeConstruction. Elements, text nodes and fix-ups are reported to the
+ * `Stats` policy (see stats.hpp).
+ *
+ * Every token is handled in amortized constant time: the number of open elements of each kind is tracked, so end
+ * tags for elements that are not open and CDATA sections are decided without walking the stack, and a walk for an
+ * end tag is paid for by the elements it closes. With TreeLimits, the stack and the number of nodes are bounded.
+ * Unknown names are interned by `Tags`, a TagInterner or a LinearTagInterner.
+*/
+template <typename Handler, typename Stats = NoStats, typename Tags = TagInterner>
+class TreeConstruction
+{
+public:
+    constexpr explicit TreeConstruction(Handler& handler,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : handler(handler), tags(resource), node_stack(resource), open_counts(known_tag_count, 0, resource)
+    {
+        node_stack.reserve(32);
+    }
+
+    /**
+     * @brief Start over with a new document. Interned names are kept, so the same custom elements in the next
+     * document do not allocate again, unless there are so many of them that they are worth freeing
+    */
+    constexpr void reset()
+    {
+        node_stack.clear();
+        if(tags.size() > max_retained_tags) {
+            tags.clear();
+            open_counts.resize(known_tag_count);
+        }
+        std::fill(open_counts.begin(), open_counts.end(), 0);
+        cdata_allowed_open = 0;
+        nodes = 0;
+    }
+
+    constexpr void set_stats(const Stats& stats) { this->stats = stats; }
+
+    constexpr void set_limits(const TreeLimits& limits) { this->limits = limits; }
+
+    constexpr void start_tag(Tag tag, const std::span<const Attribute> attributes)
+    {
+        if(tag.id == 0)
+            tag = tags.intern(tag.name);
+        add_nodes(1);
+        if(node_stack.size() >= limits.max_depth)
+            limit_depth();
+        stats.element(attributes.size());
+        handler.open(tag, attributes);
+        push(tag);
+    }
+
+    constexpr void void_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        add_nodes(1);
+        stats.element(attributes.size());
+        handler.void_element(tag, attributes);
+    }
+
+    constexpr void raw_element(const Tag tag, const std::span<const Attribute> attributes, const std::string_view text)
+    {
+        add_nodes(2);
+        stats.element(attributes.size());
+        stats.text_node();
+        handler.open(tag, attributes);
+        handler.raw_text(text);
+        handler.close(tag);
+    }
+
+    constexpr void end_tag(Tag tag)
+    {
+        // Only elements that were opened can be closed, no need to intern the name
+        if(tag.id == 0)
+            tag = tags.find(tag.name);
+        close_tag(tag);
+    }
+
+    constexpr void text(const std::string_view text)
+    {
+        add_nodes(1);
+        stats.text_node();
+        handler.text(text);
+    }
+
+    constexpr void cdata(const std::string_view text)
+    {
+        // are we in a tag allowed to have CDATA?
+        if(cdata_allowed_open != 0) {
+            add_nodes(1);
+            stats.text_node();
+            handler.text(text);
+        }
+        else
+            stats.cdata_removed();
+    }
+
+    /**
+     * @brief Close all elements that are still open
+    */
+    constexpr void finish()
+    {
+        stats.implied_end_tags(node_stack.size());
+        while(node_stack.empty() == false)
+            pop();
+    }
+
+    constexpr size_t depth() const { return node_stack.size(); }
+
+    constexpr std::span<const Tag> open_elements() const { return node_stack; }
+
+    /**
+     * @brief Start from elements that were opened elsewhere, used to continue the tree of another parser. Tags must
+     * already have their id
+    */
+    constexpr void set_open_elements(const std::span<const Tag> elements)
+    {
+        node_stack.clear();
+        std::fill(open_counts.begin(), open_counts.end(), 0);
+        cdata_allowed_open = 0;
+        for(const Tag& tag : elements)
+            push(tag);
+    }
+
+private:
+    static constexpr size_t max_retained_tags = 1024;
+
+    constexpr void add_nodes(size_t count)
+    {
+        nodes += count;
+        if(nodes > limits.max_nodes)
+            throw LimitExceeded(Limit::Nodes, "Nanoize++: The document has more nodes than Options::max_nodes");
+    }
+
+    /**
+     * @brief Make room for an element about to be opened at the maximum depth
+    */
+    constexpr void limit_depth()
+    {
+        if(limits.flatten == false)
+            throw LimitExceeded(Limit::Depth, "Nanoize++: The document is nested deeper than Options::max_depth");
+        // The new element becomes a sibling of the innermost one instead of its child
+        stats.implied_end_tags(1);
+        pop();
+    }
+
+    constexpr void close_tag(const Tag tag)
+    {
+        // is the tag valid? (never opened tags have no id)
+        if(tag.id == 0 || node_stack.empty()) {
+            stats.ignored_end_tag();
+            return;
+        }
+
+        const Tag current = node_stack.back();
+        if(current.id != tag.id) {
+            // This is tricky. We are closing a tag that is not the current tag. First we try to find the tag in the stack
+            // and close all tags in between. If we can't find it, we just ignore it.
+
+            // But special handling for <hX> tags. We can close them if the current tag is <hY> and abs(X-Y) <= 2
+            const int level = heading_level(tag.id);
+            const int current_level = heading_level(current.id);
+            if(level != 0 && current_level != 0) {
+                if(level - current_level <= 2 && current_level - level <= 2) {
+                    stats.implied_end_tags(1);
+                    pop();
+                    return;
+                }
+            }
+
+            if(is_open(tag.id) == false) {
+                stats.ignored_end_tag();
+                return;
+            }
+            // The walk stops at the matched element, so it costs no more than the elements closed
+            auto it = std::find_if(node_stack.rbegin(), node_stack.rend(), [&](const Tag& node) {
+                return node.id == tag.id;
+            });
+            if(it == node_stack.rend()) {
+                stats.ignored_end_tag();
+                return;
+            }
+            // Elements above the matched one are closed, the matched one stays open
+            size_t new_size = std::distance(it, node_stack.rend());
+            stats.implied_end_tags(node_stack.size() - new_size);
+            while(node_stack.size() > new_size)
+                pop();
+            return;
+        }
+        pop();
+    }
+
+    constexpr void push(const Tag tag)
+    {
+        node_stack.push_back(tag);
+        if(tag.id >= open_counts.size())
+            open_counts.resize(tag.id + 1, 0);
+        open_counts[tag.id]++;
+        if(has_flag(tag.id, TagFlags::CdataAllowed))
+            cdata_allowed_open++;
+    }
+
+    constexpr void pop()
+    {
+        const Tag tag = node_stack.back();
+        handler.close(tag);
+        node_stack.pop_back();
+        open_counts[tag.id]--;
+        if(has_flag(tag.id, TagFlags::CdataAllowed))
+            cdata_allowed_open--;
+    }
+
+    constexpr bool is_open(const TagId id) const
+    {
+        return id < open_counts.size() && open_counts[id] != 0;
+    }
+
+    Handler& handler;
+    [[no_unique_address]] Stats stats;
+    Tags tags;
+    ScratchVector<Tag> node_stack;
+    // Number of open elements per TagId
+    ScratchVector<uint32_t> open_counts;
+    // Number of open elements that allow CDATA
+    size_t cdata_allowed_open = 0;
+    TreeLimits limits;
+    // Elements and text nodes reported so far
+    size_t nodes = 0;
+};
+
+/**
+ * @brief Tokenizer and TreeConstruction combined: parses HTML and reports open(tag, attributes),
+ * void_element(tag, attributes), text(text), raw_text(text) and close(tag) calls to the handler in document order.
+ * See Tokenizer for how input is consumed. Both run during constant evaluation too, with a LinearTagInterner as
+ * `Tags` and no memory resource (see static_html.hpp).
+*/
+template <typename Handler, typename Stats = NoStats, typename Tags = TagInterner>
+class Parser
+{
+public:
+    constexpr explicit Parser(Handler& handler,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : tree(handler, resource), tokenizer(tree, resource)
+    {
+    }
+
+    /**
+     * @brief Start over with a new document, see TreeConstruction::reset()
+    */
+    constexpr void reset()
+    {
+        tokenizer.reset();
+        tree.reset();
+    }
+
+    /**
+     * @brief See Tokenizer::set_split_text()
+    */
+    constexpr void set_split_text(bool split) { tokenizer.set_split_text(split); }
+
+    constexpr void set_stats(const Stats& stats)
+    {
+        tokenizer.set_stats(stats);
+        tree.set_stats(stats);
+    }
+
+    constexpr void set_limits(const TreeLimits& limits) { tree.set_limits(limits); }
+
+    constexpr size_t parse(const std::string_view html, bool eof) { return tokenizer.parse(html, eof); }
+
+    /**
+     * @brief Close all elements that are still open. Must be called after the last call to parse()
+    */
+    constexpr void finish() { tree.finish(); }
+
+private:
+    TreeConstruction<Handler, Stats, Tags> tree;
+    Tokenizer<TreeConstruction<Handler, Stats, Tags>, Stats> tokenizer;
+};
+
+}
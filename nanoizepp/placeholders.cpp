@@ -0,0 +1,115 @@
+#include "nanoizepp.hpp"
+#include "attributes.hpp"
+#include "sink.hpp"
+
+#include <charconv>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp;
+using namespace nanoizepp::detail;
+
+/**
+ * @brief Replace every placeholder of `html` by a marker: the marker character, the index of the placeholder in
+ * `found` and the marker character again. Markers contain nothing the parser or the minifiers act on, and nothing
+ * lowercasing changes, so they come out of nanoize() as they went in
+*/
+static std::string replace_placeholders(const std::string_view html, const std::span<const Placeholder> placeholders,
+    std::vector<std::string_view>& found)
+{
+    for(const auto& placeholder : placeholders) {
+        if(placeholder.open.empty() || placeholder.close.empty())
+            throw std::runtime_error("Nanoize++: Placeholder delimiters cannot be empty");
+    }
+    if(html.find(placeholder_marker) != std::string_view::npos)
+        throw std::runtime_error("Nanoize++: Templates cannot contain the character U+001A");
+
+    std::string replaced;
+    replaced.reserve(html.size());
+    // Next occurrence of each opening delimiter, only searched again once it falls behind
+    std::vector<size_t> next_open(placeholders.size());
+    for(size_t i = 0; i < placeholders.size(); i++)
+        next_open[i] = html.find(placeholders[i].open);
+
+    size_t pos = 0;
+    while(true) {
+        size_t first = placeholders.size();
+        for(size_t i = 0; i < placeholders.size(); i++) {
+            if(next_open[i] < pos)
+                next_open[i] = html.find(placeholders[i].open, pos);
+            if(next_open[i] == std::string_view::npos)
+                continue;
+            if(first == placeholders.size() || next_open[i] < next_open[first]
+                || (next_open[i] == next_open[first] && placeholders[i].open.size() > placeholders[first].open.size()))
+                first = i;
+        }
+        if(first == placeholders.size())
+            break;
+
+        const size_t start = next_open[first];
+        auto end = html.find(placeholders[first].close, start + placeholders[first].open.size());
+        if(end == std::string_view::npos)
+            throw std::runtime_error("Nanoize++: Placeholder opened at byte " + std::to_string(start)
+                + " is not closed");
+        end += placeholders[first].close.size();
+
+        replaced.append(html.substr(pos, start - pos));
+        replaced.push_back(placeholder_marker);
+        replaced.append(std::to_string(found.size()));
+        replaced.push_back(placeholder_marker);
+        found.push_back(html.substr(start, end - start));
+        pos = end;
+    }
+    replaced.append(html.substr(pos));
+    return replaced;
+}
+
+/**
+ * @brief Put the placeholders back in place of their markers. Placeholders are longer than their markers, the output
+ * limit applies to the restored template
+*/
+static std::string restore_placeholders(const std::string_view minimized, const std::span<const std::string_view> found,
+    const size_t max_output)
+{
+    size_t placeholder_bytes = 0;
+    for(const auto& placeholder : found)
+        placeholder_bytes += placeholder.size();
+    std::string restored;
+    restored.reserve(minimized.size() + placeholder_bytes);
+    StringSink sink(restored);
+    sink.set_max_output(max_output);
+
+    size_t pos = 0;
+    while(true) {
+        auto marker = minimized.find(placeholder_marker, pos);
+        if(marker == std::string_view::npos)
+            break;
+        auto marker_end = minimized.find(placeholder_marker, marker + 1);
+        size_t index = found.size();
+        if(marker_end != std::string_view::npos)
+            std::from_chars(minimized.data() + marker + 1, minimized.data() + marker_end, index);
+        if(index >= found.size())
+            throw std::runtime_error("Nanoize++: Internal error: broken placeholder marker");
+        sink.append(minimized.substr(pos, marker - pos));
+        sink.append(found[index]);
+        pos = marker_end + 1;
+    }
+    sink.append(minimized.substr(pos));
+    return restored;
+}
+
+std::string nanoizepp::nanoize_template(const std::string_view html, const Options& options,
+    const std::span<const Placeholder> placeholders)
+{
+    std::vector<std::string_view> found;
+    std::string replaced = replace_placeholders(html, placeholders, found);
+    Options marked = options;
+    marked.placeholder_markers = true;
+    std::string minimized = nanoize(replaced, marked);
+    if(found.empty())
+        return minimized;
+    return restore_placeholders(minimized, found, options.max_output);
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "entities.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * Shortening of character references. Every reference ending with ';' is decoded and written back in the shortest
+ * form that means the same thing where it is: the character itself in UTF-8 when that is safe, otherwise the
+ * shortest of its name, `&#decimal;` and `&#xhex;`. References without the ';' (`&copy`) and the ones browsers
+ * remap or reject (NUL, surrogates, C1 controls, noncharacters) are copied as they are.
+ *
+ * A character is kept as a reference when writing it literally could change how the document is parsed:
+ *  - ASCII letters, digits, ';', '=' and '#', which could complete a reference without ';' written before them
+ *  - whitespace and controls, which the minifier or the parser would fold
+ *  - '&' unless followed by a character that cannot start a reference
+ *  - '<' in text and the quote character in attribute values
+*/
+
+namespace references
+{
+
+// Longest name without the ';', "CounterClockwiseContourIntegral"
+constexpr size_t max_name_length = 31;
+
+constexpr bool is_ascii_alphanumeric(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+constexpr int hex_digit_value(char c)
+{
+    if(c >= '0' && c <= '9')
+        return c - '0';
+    if(c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * @brief true if browsers decode `&#codepoint;` to `codepoint` itself
+*/
+constexpr bool is_decodable(uint32_t codepoint)
+{
+    if(codepoint == 0 || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+        return false;
+    // Remapped to windows-1252 characters
+    if(codepoint >= 0x80 && codepoint <= 0x9F)
+        return false;
+    return (codepoint < 0xFDD0 || codepoint > 0xFDEF) && (codepoint & 0xFFFE) != 0xFFFE;
+}
+
+/**
+ * @brief A decoded reference: up to two codepoints and the length of the reference in the input, 0 if the input
+ * does not start with a reference that can be decoded
+*/
+struct Decoded
+{
+    uint32_t codepoints[2] = {};
+    size_t length = 0;
+};
+
+/**
+ * @brief Decode the reference at the start of `text`, which starts with '&'
+*/
+constexpr Decoded decode(const std::string_view text)
+{
+    Decoded decoded;
+    size_t i = 1;
+    if(i < text.size() && text[i] == '#') {
+        i++;
+        const bool hex = i < text.size() && (text[i] == 'x' || text[i] == 'X');
+        if(hex)
+            i++;
+        const size_t digits_start = i;
+        uint32_t codepoint = 0;
+        for(; i < text.size(); i++) {
+            int digit = hex ? hex_digit_value(text[i]) : (text[i] >= '0' && text[i] <= '9' ? text[i] - '0' : -1);
+            if(digit < 0)
+                break;
+            // Saturate, anything this large is rejected below
+            codepoint = std::min<uint32_t>(codepoint * (hex ? 16 : 10) + digit, 0x110000);
+        }
+        if(i == digits_start || i >= text.size() || text[i] != ';' || is_decodable(codepoint) == false)
+            return decoded;
+        decoded.codepoints[0] = codepoint;
+        decoded.length = i + 1;
+        return decoded;
+    }
+
+    while(i < text.size() && i <= max_name_length && is_ascii_alphanumeric(text[i]))
+        i++;
+    if(i == 1 || i >= text.size() || text[i] != ';')
+        return decoded;
+    const std::string_view name = text.substr(1, i - 1);
+    auto entity = std::lower_bound(std::begin(named_entities), std::end(named_entities), name,
+        [](const NamedEntity& entity, const std::string_view name) {
+            return entity_names.substr(entity.name_offset, entity.name_length) < name;
+        });
+    if(entity == std::end(named_entities) || entity_names.substr(entity->name_offset, entity->name_length) != name)
+        return decoded;
+    decoded.codepoints[0] = entity->codepoint;
+    decoded.codepoints[1] = entity_second_codepoints[entity->second];
+    decoded.length = i + 1;
+    return decoded;
+}
+
+/**
+ * @brief true if `codepoint`, decoded from a reference followed by `next` (0 at the end of the text), has to stay a
+ * reference. `quote` is the quote around the attribute value, 0 in text
+*/
+constexpr bool needs_reference(uint32_t codepoint, char next, char quote)
+{
+    if(codepoint < 0x21 || codepoint == 0x7F || codepoint == 0xFEFF)
+        return true;
+    if(codepoint >= 0x80)
+        return false;
+    const char c = char(codepoint);
+    if(is_ascii_alphanumeric(c) || c == ';' || c == '=' || c == '#')
+        return true;
+    // The end of the text may be followed by more text, when it is streamed
+    if(c == '&')
+        return next == 0 || is_ascii_alphanumeric(next) || next == '#';
+    if(quote == 0)
+        return c == '<';
+    return c == quote;
+}
+
+template <typename Sink>
+constexpr void append_number(Sink& out, uint32_t value, int base)
+{
+    char digits[8] = {};
+    size_t count = 0;
+    do {
+        digits[sizeof(digits) - ++count] = "0123456789abcdef"[value % base];
+        value /= base;
+    } while(value != 0);
+    out.append(std::string_view(digits + sizeof(digits) - count, count));
+}
+
+constexpr size_t digit_count(uint32_t value, uint32_t base)
+{
+    size_t count = 1;
+    while(value >= base) {
+        value /= base;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Write `codepoint` as the shortest of its name, `&#decimal;` and `&#xhex;`
+*/
+template <typename Sink>
+constexpr void append_reference(Sink& out, uint32_t codepoint)
+{
+    const size_t decimal = digit_count(codepoint, 10) + 3;
+    const size_t hex = digit_count(codepoint, 16) + 4;
+    auto shortest = std::lower_bound(std::begin(shortest_entity_names), std::end(shortest_entity_names), codepoint,
+        [](const EntityShortestName& entry, uint32_t codepoint) { return entry.codepoint < codepoint; });
+    if(shortest != std::end(shortest_entity_names) && shortest->codepoint == codepoint) {
+        const NamedEntity& entity = named_entities[shortest->entity];
+        if(size_t(entity.name_length) + 2 <= std::min(decimal, hex)) {
+            out.append(1, '&');
+            out.append(entity_names.substr(entity.name_offset, entity.name_length));
+            out.append(1, ';');
+            return;
+        }
+    }
+    out.append(hex < decimal ? "&#x" : "&#");
+    append_number(out, codepoint, hex < decimal ? 16 : 10);
+    out.append(1, ';');
+}
+
+template <typename Sink>
+constexpr void append_utf8(Sink& out, uint32_t codepoint)
+{
+    char bytes[4] = {};
+    size_t count = 0;
+    if(codepoint < 0x80)
+        bytes[count++] = char(codepoint);
+    else if(codepoint < 0x800) {
+        bytes[count++] = char(0xC0 | (codepoint >> 6));
+        bytes[count++] = char(0x80 | (codepoint & 0x3F));
+    }
+    else if(codepoint < 0x10000) {
+        bytes[count++] = char(0xE0 | (codepoint >> 12));
+        bytes[count++] = char(0x80 | ((codepoint >> 6) & 0x3F));
+        bytes[count++] = char(0x80 | (codepoint & 0x3F));
+    }
+    else {
+        bytes[count++] = char(0xF0 | (codepoint >> 18));
+        bytes[count++] = char(0x80 | ((codepoint >> 12) & 0x3F));
+        bytes[count++] = char(0x80 | ((codepoint >> 6) & 0x3F));
+        bytes[count++] = char(0x80 | (codepoint & 0x3F));
+    }
+    out.append(std::string_view(bytes, count));
+}
+
+}
+
+/**
+ * @brief Write `text` with its character references shortened. In an attribute value quoted with `quote`, the quote
+ * characters it contains are escaped, `quote` is 0 in text and in values that are not quoted
+*/
+template <typename Sink>
+constexpr void append_shortened_references(Sink& out, std::string_view text, const char quote = 0)
+{
+    using namespace references;
+    const char specials[] = {'&', quote};
+    const std::string_view special(specials, quote == 0 ? 1 : 2);
+    for(size_t found = text.find_first_of(special); found != std::string_view::npos;
+        found = text.find_first_of(special)) {
+        out.append(text.substr(0, found));
+        text.remove_prefix(found);
+        if(text[0] == quote) {
+            append_reference(out, uint8_t(quote));
+            text.remove_prefix(1);
+            continue;
+        }
+        const Decoded decoded = decode(text);
+        if(decoded.length == 0) {
+            out.append(1, '&');
+            text.remove_prefix(1);
+            continue;
+        }
+        text.remove_prefix(decoded.length);
+        for(size_t i = 0; i < 2 && decoded.codepoints[i] != 0; i++) {
+            // The second codepoint of a named reference follows the first one, only its first byte matters
+            const uint32_t following = i == 0 ? decoded.codepoints[1] : 0;
+            char next = following != 0 ? char(std::min<uint32_t>(following, 0x80)) : (text.empty() ? 0 : text[0]);
+            if(needs_reference(decoded.codepoints[i], next, quote))
+                append_reference(out, decoded.codepoints[i]);
+            else
+                append_utf8(out, decoded.codepoints[i]);
+        }
+    }
+    out.append(text);
+}
+
+}
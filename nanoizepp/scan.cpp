@@ -0,0 +1,336 @@
+#include "scan.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+
+#if !defined(NANOIZEPP_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define NANOIZEPP_X86
+#include <immintrin.h>
+#elif !defined(NANOIZEPP_NO_SIMD) && (defined(__aarch64__) || defined(__ARM_NEON))
+#define NANOIZEPP_NEON
+#include <arm_neon.h>
+#endif
+
+// AVX2 kernels are compiled for the AVX2 target and only called when the CPU supports it
+#if defined(NANOIZEPP_X86) && (defined(__GNUC__) || defined(__clang__))
+#define NANOIZEPP_AVX2
+#define NANOIZEPP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+// The vector loop has to be inlined into each kernel so it is compiled for the kernel's instruction set
+#if defined(__GNUC__) || defined(__clang__)
+#define NANOIZEPP_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define NANOIZEPP_ALWAYS_INLINE inline
+#endif
+
+using namespace nanoizepp::detail;
+
+constexpr size_t npos = std::string_view::npos;
+
+template <bool Negate>
+static size_t scalar_scan(const char* data, size_t size, const CharSet& set)
+{
+    for(size_t i = 0; i < size; i++) {
+        if(set.contains(data[i]) != Negate)
+            return i;
+    }
+    return npos;
+}
+
+static bool is_whitespace(char c)
+{
+    return whitespace_chars.contains(c);
+}
+
+/**
+ * @brief Whether position `i` needs rewriting when minimizing text: NUL, whitespace other than ' ', or a ' ' that
+ * starts a run of whitespace
+*/
+static bool needs_rewrite(const char* data, size_t size, size_t i)
+{
+    char c = data[i];
+    if(c == '\0')
+        return true;
+    if(c == ' ')
+        return i + 1 < size && is_whitespace(data[i + 1]);
+    return is_whitespace(c);
+}
+
+static size_t scalar_rewrite_scan(const char* data, size_t size)
+{
+    for(size_t i = 0; i < size; i++) {
+        if(needs_rewrite(data, size, i))
+            return i;
+    }
+    return npos;
+}
+
+/**
+ * @brief Combine per-lane masks (one bit per byte) into the rewrite mask of a block of `lanes` bytes. The last lane
+ * also depends on the byte following the block
+*/
+static uint32_t rewrite_mask(uint32_t whitespace, uint32_t space, uint32_t nul, const char* data, size_t size, size_t i, size_t lanes)
+{
+    uint32_t mask = (whitespace & ~space) | (space & (whitespace >> 1)) | nul;
+    uint32_t last = uint32_t(1) << (lanes - 1);
+    if((space & last) && i + lanes < size && is_whitespace(data[i + lanes]))
+        mask |= last;
+    return mask;
+}
+
+/**
+ * @brief Run a vector kernel over `size` bytes. `block_mask(i)` classifies the `Lanes` bytes starting at `i` into a
+ * bit mask of matches. The end of the input is handled by one more block overlapping the previous one, with the
+ * already checked lanes masked out, instead of a scalar loop. Inputs shorter than a block go to `scalar`.
+*/
+template <size_t Lanes, typename BlockMask, typename Scalar>
+NANOIZEPP_ALWAYS_INLINE static size_t vector_scan(size_t size, BlockMask&& block_mask, Scalar&& scalar)
+{
+    if(size < Lanes)
+        return scalar(size);
+    size_t i = 0;
+    for(; i + Lanes <= size; i += Lanes) {
+        uint32_t mask = block_mask(i);
+        if(mask != 0)
+            return i + std::countr_zero(mask);
+    }
+    if(i == size)
+        return npos;
+    size_t last = size - Lanes;
+    uint32_t mask = block_mask(last) & (~uint32_t(0) << (i - last));
+    if(mask != 0)
+        return last + std::countr_zero(mask);
+    return npos;
+}
+
+#ifdef NANOIZEPP_X86
+template <bool Negate>
+static size_t sse2_scan(const char* data, size_t size, const CharSet& set)
+{
+    __m128i needles[CharSet::max_size];
+    for(size_t k = 0; k < set.size; k++)
+        needles[k] = _mm_set1_epi8(set.chars[k]);
+
+    auto block_mask = [&](size_t i) -> uint32_t {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i matches = _mm_cmpeq_epi8(chunk, needles[0]);
+        for(size_t k = 1; k < set.size; k++)
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, needles[k]));
+        uint32_t mask = _mm_movemask_epi8(matches);
+        if constexpr(Negate)
+            mask = ~mask & 0xffff;
+        return mask;
+    };
+    return vector_scan<16>(size, block_mask, [&](size_t n) { return scalar_scan<Negate>(data, n, set); });
+}
+
+static size_t sse2_rewrite_scan(const char* data, size_t size)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i zero = _mm_setzero_si128();
+
+    auto block_mask = [&](size_t i) -> uint32_t {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i spaces = _mm_cmpeq_epi8(chunk, space);
+        __m128i whitespace = _mm_or_si128(_mm_or_si128(spaces, _mm_cmpeq_epi8(chunk, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, lf), _mm_cmpeq_epi8(chunk, cr)));
+        return rewrite_mask(_mm_movemask_epi8(whitespace), _mm_movemask_epi8(spaces),
+            _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero)), data, size, i, 16);
+    };
+    return vector_scan<16>(size, block_mask, [&](size_t n) { return scalar_rewrite_scan(data, n); });
+}
+#endif
+
+#ifdef NANOIZEPP_AVX2
+template <bool Negate>
+NANOIZEPP_TARGET_AVX2 static size_t avx2_scan(const char* data, size_t size, const CharSet& set)
+{
+    // Calling into SSE code with dirty upper AVX state is expensive, decide before touching any AVX register
+    if(size < 32)
+        return sse2_scan<Negate>(data, size, set);
+    __m256i needles[CharSet::max_size];
+    for(size_t k = 0; k < set.size; k++)
+        needles[k] = _mm256_set1_epi8(set.chars[k]);
+
+    auto block_mask = [&](size_t i) NANOIZEPP_TARGET_AVX2 -> uint32_t {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i matches = _mm256_cmpeq_epi8(chunk, needles[0]);
+        for(size_t k = 1; k < set.size; k++)
+            matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(chunk, needles[k]));
+        uint32_t mask = _mm256_movemask_epi8(matches);
+        if constexpr(Negate)
+            mask = ~mask;
+        return mask;
+    };
+    return vector_scan<32>(size, block_mask, [&](size_t n) { return scalar_scan<Negate>(data, n, set); });
+}
+
+NANOIZEPP_TARGET_AVX2 static size_t avx2_rewrite_scan(const char* data, size_t size)
+{
+    if(size < 32)
+        return sse2_rewrite_scan(data, size);
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i zero = _mm256_setzero_si256();
+
+    auto block_mask = [&](size_t i) NANOIZEPP_TARGET_AVX2 -> uint32_t {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i spaces = _mm256_cmpeq_epi8(chunk, space);
+        __m256i whitespace = _mm256_or_si256(_mm256_or_si256(spaces, _mm256_cmpeq_epi8(chunk, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, lf), _mm256_cmpeq_epi8(chunk, cr)));
+        return rewrite_mask(_mm256_movemask_epi8(whitespace), _mm256_movemask_epi8(spaces),
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, zero)), data, size, i, 32);
+    };
+    return vector_scan<32>(size, block_mask, [&](size_t n) { return scalar_rewrite_scan(data, n); });
+}
+#endif
+
+#ifdef NANOIZEPP_NEON
+// One bit per byte from a NEON comparison result
+static uint32_t neon_movemask(uint8x16_t matches)
+{
+    const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t masked = vandq_u8(matches, bits);
+    return vaddv_u8(vget_low_u8(masked)) | (uint32_t(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+template <bool Negate>
+static size_t neon_scan(const char* data, size_t size, const CharSet& set)
+{
+    uint8x16_t needles[CharSet::max_size];
+    for(size_t k = 0; k < set.size; k++)
+        needles[k] = vdupq_n_u8(static_cast<uint8_t>(set.chars[k]));
+
+    auto block_mask = [&](size_t i) -> uint32_t {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        uint8x16_t matches = vceqq_u8(chunk, needles[0]);
+        for(size_t k = 1; k < set.size; k++)
+            matches = vorrq_u8(matches, vceqq_u8(chunk, needles[k]));
+        if constexpr(Negate)
+            matches = vmvnq_u8(matches);
+        return neon_movemask(matches);
+    };
+    return vector_scan<16>(size, block_mask, [&](size_t n) { return scalar_scan<Negate>(data, n, set); });
+}
+
+static size_t neon_rewrite_scan(const char* data, size_t size)
+{
+    auto block_mask = [&](size_t i) -> uint32_t {
+        uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        uint8x16_t spaces = vceqq_u8(chunk, vdupq_n_u8(' '));
+        uint8x16_t whitespace = vorrq_u8(vorrq_u8(spaces, vceqq_u8(chunk, vdupq_n_u8('\t'))),
+            vorrq_u8(vceqq_u8(chunk, vdupq_n_u8('\n')), vceqq_u8(chunk, vdupq_n_u8('\r'))));
+        return rewrite_mask(neon_movemask(whitespace), neon_movemask(spaces),
+            neon_movemask(vceqq_u8(chunk, vdupq_n_u8(0))), data, size, i, 16);
+    };
+    return vector_scan<16>(size, block_mask, [&](size_t n) { return scalar_rewrite_scan(data, n); });
+}
+#endif
+
+using ScanFunction = size_t (*)(const char*, size_t, const CharSet&);
+using RewriteScanFunction = size_t (*)(const char*, size_t);
+
+struct Kernels
+{
+    ScanKernel kernel;
+    ScanFunction first_of;
+    ScanFunction first_not_of;
+    RewriteScanFunction text_rewrite;
+};
+
+static Kernels make_kernels(ScanKernel kernel)
+{
+    switch(kernel) {
+#ifdef NANOIZEPP_X86
+    case ScanKernel::SSE2:
+        return {kernel, sse2_scan<false>, sse2_scan<true>, sse2_rewrite_scan};
+#endif
+#ifdef NANOIZEPP_AVX2
+    case ScanKernel::AVX2:
+        return {kernel, avx2_scan<false>, avx2_scan<true>, avx2_rewrite_scan};
+#endif
+#ifdef NANOIZEPP_NEON
+    case ScanKernel::NEON:
+        return {kernel, neon_scan<false>, neon_scan<true>, neon_rewrite_scan};
+#endif
+    default:
+        return {ScanKernel::Scalar, scalar_scan<false>, scalar_scan<true>, scalar_rewrite_scan};
+    }
+}
+
+static const Kernels& kernels_of(ScanKernel kernel)
+{
+    static const std::array<Kernels, 4> table = {make_kernels(ScanKernel::Scalar), make_kernels(ScanKernel::SSE2),
+        make_kernels(ScanKernel::AVX2), make_kernels(ScanKernel::NEON)};
+    return table[size_t(kernel)];
+}
+
+/**
+ * @brief The kernels in use. set_scan_kernel() may swap them while other threads scan: each set is immutable, so a
+ * relaxed load of the pointer is enough
+*/
+static std::atomic<const Kernels*>& selected_kernels()
+{
+    static std::atomic<const Kernels*> selected{&kernels_of(available_scan_kernels().back())};
+    return selected;
+}
+
+static const Kernels& kernels()
+{
+    return *selected_kernels().load(std::memory_order_relaxed);
+}
+
+std::vector<ScanKernel> nanoizepp::detail::available_scan_kernels()
+{
+    std::vector<ScanKernel> result = {ScanKernel::Scalar};
+#ifdef NANOIZEPP_X86
+    result.push_back(ScanKernel::SSE2);
+#endif
+#ifdef NANOIZEPP_AVX2
+    if(__builtin_cpu_supports("avx2"))
+        result.push_back(ScanKernel::AVX2);
+#endif
+#ifdef NANOIZEPP_NEON
+    result.push_back(ScanKernel::NEON);
+#endif
+    return result;
+}
+
+bool nanoizepp::detail::set_scan_kernel(ScanKernel kernel)
+{
+    auto available = available_scan_kernels();
+    if(std::find(available.begin(), available.end(), kernel) == available.end())
+        return false;
+    selected_kernels().store(&kernels_of(kernel), std::memory_order_relaxed);
+    return true;
+}
+
+ScanKernel nanoizepp::detail::current_scan_kernel()
+{
+    return kernels().kernel;
+}
+
+size_t nanoizepp::detail::simd_first_of(const char* data, size_t size, const CharSet& set)
+{
+    return kernels().first_of(data, size, set);
+}
+
+size_t nanoizepp::detail::simd_first_not_of(const char* data, size_t size, const CharSet& set)
+{
+    return kernels().first_not_of(data, size, set);
+}
+
+size_t nanoizepp::detail::simd_text_rewrite(const char* data, size_t size)
+{
+    return kernels().text_rewrite(data, size);
+}
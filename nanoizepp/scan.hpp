@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * @brief A small set of characters (at most 8) to scan for. The kernels compare against every character stored, so
+ * a set that does not fit is rejected rather than cut short; in a constant expression that is a compile error
+*/
+struct CharSet
+{
+    static constexpr size_t max_size = 8;
+
+    constexpr CharSet(const std::string_view set) : size(set.size())
+    {
+        if(set.empty() || set.size() > max_size)
+            throw std::runtime_error("Nanoize++: A CharSet holds 1 to 8 characters");
+        for(size_t i = 0; i < set.size(); i++) {
+            chars[i] = set[i];
+            table[(unsigned char)set[i]] = true;
+        }
+    }
+
+    constexpr bool contains(char c) const { return table[(unsigned char)c]; }
+
+    std::array<char, max_size> chars = {};
+    size_t size;
+    std::array<bool, 256> table = {};
+};
+
+inline constexpr CharSet whitespace_chars(" \t\n\r");
+
+enum class ScanKernel
+{
+    Scalar,
+    SSE2,
+    AVX2,
+    NEON
+};
+
+/**
+ * @brief Kernels usable on this machine, the fastest one last
+*/
+std::vector<ScanKernel> available_scan_kernels();
+
+/**
+ * @brief Force a kernel (for testing and benchmarking). Scans running on other threads finish with the kernel
+ * they started with
+ * @return false if the kernel is not available on this machine
+*/
+bool set_scan_kernel(ScanKernel kernel);
+
+ScanKernel current_scan_kernel();
+
+// Dispatched implementations, use scan_first_of()/scan_first_not_of()/scan_text_rewrite() instead
+size_t simd_first_of(const char* data, size_t size, const CharSet& set);
+size_t simd_first_not_of(const char* data, size_t size, const CharSet& set);
+size_t simd_text_rewrite(const char* data, size_t size);
+
+// The scans below also work in constant evaluation (see static_html.hpp), where they fall back to plain loops
+
+/**
+ * @brief Find the first position where minimizing text changes it: a NUL, a whitespace other than ' ', or a ' '
+ * followed by more whitespace. Lone spaces between words are skipped without leaving the vector loop
+*/
+constexpr size_t scan_text_rewrite(const std::string_view sv)
+{
+    if(std::is_constant_evaluated() == false)
+        return simd_text_rewrite(sv.data(), sv.size());
+    for(size_t i = 0; i < sv.size(); i++) {
+        if(sv[i] == '\0' || (sv[i] != ' ' && whitespace_chars.contains(sv[i]))
+            || (sv[i] == ' ' && i + 1 < sv.size() && whitespace_chars.contains(sv[i + 1])))
+            return i;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * @brief Same as std::string_view::find_first_of(), but classifies 16/32 bytes at a time when possible
+*/
+constexpr size_t scan_first_of(const std::string_view sv, const CharSet& set)
+{
+    // Not worth setting up vectors for short strings
+    if(sv.size() < 16 || std::is_constant_evaluated()) {
+        for(size_t i = 0; i < sv.size(); i++) {
+            if(set.contains(sv[i]))
+                return i;
+        }
+        return std::string_view::npos;
+    }
+    return simd_first_of(sv.data(), sv.size(), set);
+}
+
+/**
+ * @brief Same as std::string_view::find_first_not_of(), but classifies 16/32 bytes at a time when possible
+*/
+constexpr size_t scan_first_not_of(const std::string_view sv, const CharSet& set)
+{
+    // Most runs end right away
+    for(size_t i = 0; i < sv.size() && (i < 16 || std::is_constant_evaluated()); i++) {
+        if(set.contains(sv[i]) == false)
+            return i;
+    }
+    if(sv.size() <= 16 || std::is_constant_evaluated())
+        return std::string_view::npos;
+    auto pos = simd_first_not_of(sv.data() + 16, sv.size() - 16, set);
+    return pos == std::string_view::npos ? pos : pos + 16;
+}
+
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+
+#include <cstdint>
+#include <string>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+#include <functional>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * Output sinks. Everything that writes minimized HTML goes through one of these, so the same serializer can target
+ * a caller-owned std::string, a std::vector<char> or a callback. A sink provides
+ *   append(std::string_view) and append(size_t count, char c)
+ * The sinks that keep the output also enforce Options::max_output, through set_max_output()
+*/
+
+/**
+ * @brief Bytes a sink may still write
+*/
+class OutputBudget
+{
+public:
+    /**
+     * @param max_output 0 for no limit
+    */
+    constexpr void reset(size_t max_output) { remaining = max_output == 0 ? SIZE_MAX : max_output; }
+
+    /**
+     * @brief Account for `size` more bytes, throws LimitExceeded before they are written if there is no room left
+    */
+    constexpr void spend(size_t size)
+    {
+        if(size > remaining)
+            throw LimitExceeded(Limit::Output, "Nanoize++: The output is larger than Options::max_output");
+        remaining -= size;
+    }
+
+private:
+    size_t remaining = SIZE_MAX;
+};
+
+template <typename String>
+class BasicStringSink
+{
+public:
+    constexpr explicit BasicStringSink(String& out) : out(&out) {}
+    constexpr void append(const std::string_view sv)
+    {
+        budget.spend(sv.size());
+        out->append(sv);
+    }
+    constexpr void append(size_t count, char c)
+    {
+        budget.spend(count);
+        out->append(count, c);
+    }
+    constexpr void set_max_output(size_t max_output) { budget.reset(max_output); }
+
+    /**
+     * @brief Write to `target` from now on, so a writer holding the sink can fill another string
+    */
+    constexpr void set_target(String& target) { out = &target; }
+
+private:
+    String* out;
+    OutputBudget budget;
+};
+
+using StringSink = BasicStringSink<std::string>;
+using PmrStringSink = BasicStringSink<std::pmr::string>;
+
+class VectorSink
+{
+public:
+    explicit VectorSink(std::vector<char>& out) : out(out) {}
+    void append(const std::string_view sv)
+    {
+        budget.spend(sv.size());
+        out.insert(out.end(), sv.begin(), sv.end());
+    }
+    void append(size_t count, char c)
+    {
+        budget.spend(count);
+        out.insert(out.end(), count, c);
+    }
+    void set_max_output(size_t max_output) { budget.reset(max_output); }
+
+private:
+    std::vector<char>& out;
+    OutputBudget budget;
+};
+
+/**
+ * @brief Throws the output away, for running a writer only to see whether it succeeds
+*/
+class DiscardSink
+{
+public:
+    void append(const std::string_view) {}
+    void append(size_t, char) {}
+};
+
+/**
+ * @brief Collects output into blocks of `block_size` bytes and hands them to a callback. Call flush() at the end
+*/
+class CallbackSink
+{
+public:
+    static constexpr size_t block_size = 16 * 1024;
+
+    explicit CallbackSink(const std::function<void(std::string_view)>& callback) : callback(callback)
+    {
+        buffer.reserve(block_size);
+    }
+
+    void append(const std::string_view sv)
+    {
+        budget.spend(sv.size());
+        if(buffer.size() + sv.size() > block_size) {
+            flush();
+            // Too big to be worth buffering
+            if(sv.size() >= block_size) {
+                callback(sv);
+                return;
+            }
+        }
+        buffer.append(sv);
+    }
+
+    void append(size_t count, char c)
+    {
+        budget.spend(count);
+        if(buffer.size() + count > block_size)
+            flush();
+        buffer.append(count, c);
+    }
+
+    void set_max_output(size_t max_output) { budget.reset(max_output); }
+
+    void flush()
+    {
+        if(buffer.empty())
+            return;
+        callback(buffer);
+        buffer.clear();
+    }
+
+private:
+    const std::function<void(std::string_view)>& callback;
+    std::string buffer;
+    OutputBudget budget;
+};
+
+/**
+ * @brief Guess how large the minimized output of `html` will be so the output buffer only needs to be allocated once
+*/
+inline size_t estimate_output_size(const std::string_view html, size_t indent, bool newline)
+{
+    // Minimizing almost never grows the document. Leave some room for end tags added by auto closing
+    if(indent == 0 && newline == false)
+        return html.size() + html.size() / 16 + 64;
+    return html.size() * 2 + 64;
+}
+
+/**
+ * @brief Empty `out` and make room for the output of `html`, so it only needs to be allocated once. Never more room
+ * than Options::max_output allows: a limited document does not allocate for output it may not produce
+ * @return true if `out` had to grow
+*/
+template <typename Buffer>
+bool prepare_output(Buffer& out, const std::string_view html, const Options& options)
+{
+    out.clear();
+    size_t size = estimate_output_size(html, options.indent, options.newline);
+    // One byte past the limit is as far as a sink gets before it throws
+    if(options.max_output != 0 && options.max_output < size)
+        size = options.max_output + 1;
+    if(out.capacity() >= size)
+        return false;
+    out.reserve(size);
+    return true;
+}
+
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+#include "emitter.hpp"
+#include "parser.hpp"
+#include "sink.hpp"
+#include "tags.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace nanoizepp
+{
+
+namespace detail
+{
+
+/**
+ * @brief nanoize() usable in constant expressions. The single pass engine with the interner and the allocator that
+ * work during constant evaluation, which rules out the SIMD scans, memory resources and hash tables
+*/
+constexpr std::string nanoize_constexpr(const std::string_view html, const Options& options = {})
+{
+    std::string out;
+    StringSink sink(out);
+    sink.set_max_output(options.max_output);
+    Emitter<StringSink> emitter(sink, options);
+    Parser<Emitter<StringSink>, NoStats, LinearTagInterner> parser(emitter, nullptr);
+    parser.set_limits(tree_limits(options));
+    parser.parse(html, true);
+    parser.finish();
+    return out;
+}
+
+/**
+ * @brief A string literal usable as a template argument
+*/
+template <size_t N>
+struct FixedString
+{
+    char chars[N] = {};
+
+    consteval FixedString(const char (&literal)[N])
+    {
+        std::copy_n(literal, N, chars);
+    }
+
+    constexpr std::string_view view() const { return {chars, N - 1}; }
+};
+
+template <FixedString html, Options options>
+struct StaticHtml
+{
+    static_assert(options.minify_css == false && options.minify_js == false,
+        "Nanoize++: CSS and JavaScript minification are not available at compile time");
+
+    static constexpr std::string minimize()
+    {
+        // GCC cannot compare pointers into template argument objects in constant expressions, work on a copy
+        std::string input(html.view().size(), '\0');
+        std::copy(html.chars, html.chars + input.size(), input.begin());
+        return nanoize_constexpr(input, options);
+    }
+
+    static constexpr size_t size = minimize().size();
+
+    static consteval std::array<char, size + 1> to_array()
+    {
+        std::array<char, size + 1> chars = {};
+        std::string minimized = minimize();
+        std::copy(minimized.begin(), minimized.end(), chars.begin());
+        return chars;
+    }
+
+    // NUL terminated, for APIs that want a C string
+    static constexpr std::array<char, size + 1> chars = to_array();
+};
+
+}
+
+/**
+ * @brief HTML minimized at compile time, for markup that is fixed in the program (error pages, layout shells, email
+ * templates...)
+ *
+ * The result is a std::string_view of a constant array in read-only data: no work and no allocation at run time. It
+ * is identical to nanoize() with the same options. CSS and JavaScript minification are not supported, and a
+ * document nanoize() would reject (a DOCTYPE other than HTML5) fails to compile.
+ *
+ * @code
+ * constexpr std::string_view page = nanoizepp::static_html<R"(
+ *     <html>
+ *         <body><p>Not found</p></body>
+ *     </html>)">;
+ * @endcode
+*/
+template <detail::FixedString html, Options options = Options{}>
+inline constexpr std::string_view static_html{detail::StaticHtml<html, options>::chars.data(),
+    detail::StaticHtml<html, options>::size};
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * Statistics policies of Tokenizer and TreeConstruction. They call the policy at every event worth counting.
+ * NoStats, the default, has empty members that compile away; StatsRecorder adds the events to a DocumentStats.
+*/
+
+struct NoStats
+{
+    constexpr void text(size_t, size_t) {}
+    constexpr void comment() {}
+    constexpr void element(size_t) {}
+    constexpr void text_node() {}
+    constexpr void cdata_removed() {}
+    constexpr void implied_end_tags(size_t) {}
+    constexpr void ignored_end_tag() {}
+};
+
+struct StatsRecorder
+{
+    DocumentStats* stats = nullptr;
+
+    /**
+     * @brief A text run of `input_size` bytes was written as `output_size` bytes (0 if dropped)
+    */
+    void text(size_t input_size, size_t output_size)
+    {
+        if(input_size > output_size)
+            stats->whitespace_removed += input_size - output_size;
+    }
+
+    void comment() { stats->comments_removed++; }
+
+    void element(size_t attributes)
+    {
+        stats->elements++;
+        stats->attributes += attributes;
+    }
+
+    void text_node() { stats->text_nodes++; }
+    void cdata_removed() { stats->cdata_removed++; }
+    void implied_end_tags(size_t count) { stats->implied_end_tags += count; }
+    void ignored_end_tag() { stats->ignored_end_tags++; }
+};
+
+/**
+ * @brief Memory resource counting the allocations passed on to another one
+*/
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream(upstream) {}
+
+    size_t allocations() const { return allocation_count; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocation_count++;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream;
+    size_t allocation_count = 0;
+};
+
+}
@@ -0,0 +1,92 @@
+#include "nanoizepp.hpp"
+#include "parser.hpp"
+#include "emitter.hpp"
+#include "sink.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace nanoizepp;
+using namespace nanoizepp::detail;
+
+// Unfinished constructs up to this size are cheap enough to retry on every chunk
+static constexpr size_t eager_retry_size = 1024;
+
+struct StreamNanoizer::Impl
+{
+    explicit Impl(const Options& options)
+        : sink(output), emitter(sink, options), parser(emitter)
+    {
+        // Splitting a text run only works if the pieces end up next to each other, and are not decoded (a piece could
+        // end in the middle of a character reference)
+        parser.set_split_text(options.indent == 0 && options.newline == false && options.minify_entities == false);
+        parser.set_limits(tree_limits(options));
+        // The limit is on the whole document, whatever was already handed out
+        sink.set_max_output(options.max_output);
+    }
+
+    std::string take_output()
+    {
+        std::string result = std::move(output);
+        output.clear();
+        return result;
+    }
+
+    std::string output;
+    // Input that could not be parsed yet because it ends in an unfinished construct
+    std::string buffer;
+    // Size the buffer must reach before parsing it again
+    size_t retry_size = 0;
+    StringSink sink;
+    Emitter<StringSink> emitter;
+    Parser<Emitter<StringSink>> parser;
+    bool finished = false;
+};
+
+StreamNanoizer::StreamNanoizer(size_t indent, bool newline)
+    : StreamNanoizer(Options{.indent = indent, .newline = newline})
+{
+}
+
+StreamNanoizer::StreamNanoizer(const Options& options)
+    : impl(std::make_unique<Impl>(options))
+{
+}
+
+StreamNanoizer::~StreamNanoizer() = default;
+StreamNanoizer::StreamNanoizer(StreamNanoizer&&) noexcept = default;
+StreamNanoizer& StreamNanoizer::operator=(StreamNanoizer&&) noexcept = default;
+
+std::string StreamNanoizer::feed(const std::string_view chunk)
+{
+    if(impl->finished)
+        throw std::runtime_error("Nanoize++: feed() called after finish()");
+
+    if(impl->buffer.empty()) {
+        // Fast path, parse directly from the chunk and only keep the unfinished tail
+        size_t consumed = impl->parser.parse(chunk, false);
+        impl->buffer.assign(chunk.substr(consumed));
+    }
+    else {
+        impl->buffer += chunk;
+        // Retrying on every chunk would scan a long unfinished construct (a comment, a script...) again for each
+        // chunk. Waiting until the buffer doubled since the last attempt keeps the total work linear in the input
+        if(impl->buffer.size() < impl->retry_size)
+            return impl->take_output();
+        size_t consumed = impl->parser.parse(impl->buffer, false);
+        impl->buffer.erase(0, consumed);
+    }
+    impl->retry_size = impl->buffer.size() < eager_retry_size ? 0 : 2 * impl->buffer.size();
+    return impl->take_output();
+}
+
+std::string StreamNanoizer::finish()
+{
+    if(impl->finished)
+        return "";
+    impl->finished = true;
+    impl->parser.parse(impl->buffer, true);
+    impl->parser.finish();
+    impl->buffer.clear();
+    return impl->take_output();
+}
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * Element classification. Known HTML element names map to a small integer through a perfect hash computed at
+ * compile time. Names are matched case-insensitively, the same way the HTML tokenizer lowercases tag names.
+ * Unknown and custom elements get ids above the known range from a per-parser TagInterner.
+*/
+
+using TagId = uint32_t;
+
+namespace TagFlags
+{
+    // No end tag and no content (<br>, <img>, ...)
+    inline constexpr uint8_t Void = 1;
+    // Content is kept byte for byte (<script>, <pre>, ...)
+    inline constexpr uint8_t RawText = 2;
+    // May contain CDATA sections (<svg>, <math>)
+    inline constexpr uint8_t CdataAllowed = 4;
+    // End tag may be omitted in valid HTML
+    inline constexpr uint8_t OptionalEnd = 8;
+}
+
+struct TagInfo
+{
+    std::string_view name;
+    uint8_t flags = 0;
+    // 1-6 for <h1>-<h6>, 0 otherwise
+    uint8_t heading_level = 0;
+};
+
+struct Tag
+{
+    TagId id = 0;
+    // Canonical (lowercase) name, stays valid for the lifetime of the parser
+    std::string_view name;
+};
+
+// Index in this table is the TagId. Id 0 is reserved for "not a known element"
+inline constexpr TagInfo known_tags[] = {
+    {""},
+    {"!DOCTYPE", TagFlags::Void},
+    {"a"}, {"abbr"}, {"acronym"}, {"address"}, {"applet"}, {"area", TagFlags::Void}, {"article"}, {"aside"},
+    {"audio"}, {"b"}, {"base", TagFlags::Void}, {"basefont"}, {"bdi"}, {"bdo"}, {"big"}, {"blink"},
+    {"blockquote"}, {"body", TagFlags::OptionalEnd}, {"br", TagFlags::Void}, {"button"}, {"canvas"},
+    {"caption", TagFlags::OptionalEnd}, {"center"}, {"cite"}, {"code", TagFlags::RawText},
+    {"col", TagFlags::Void}, {"colgroup", TagFlags::OptionalEnd}, {"data"}, {"datalist"},
+    {"dd", TagFlags::OptionalEnd}, {"del"}, {"details"}, {"dfn"}, {"dialog"}, {"dir"}, {"div"}, {"dl"},
+    {"dt", TagFlags::OptionalEnd}, {"em"}, {"embed", TagFlags::Void}, {"fieldset"}, {"figcaption"}, {"figure"},
+    {"font"}, {"footer"}, {"form"}, {"frame"}, {"frameset"}, {"h1", 0, 1}, {"h2", 0, 2}, {"h3", 0, 3},
+    {"h4", 0, 4}, {"h5", 0, 5}, {"h6", 0, 6}, {"head", TagFlags::OptionalEnd}, {"header"}, {"hgroup"},
+    {"hr", TagFlags::Void}, {"html", TagFlags::OptionalEnd}, {"i"}, {"iframe"}, {"img", TagFlags::Void},
+    {"input", TagFlags::Void}, {"ins"}, {"kbd", TagFlags::RawText}, {"label"}, {"legend"},
+    {"li", TagFlags::OptionalEnd}, {"link", TagFlags::Void}, {"main"}, {"map"}, {"mark"}, {"marquee"},
+    {"math", TagFlags::CdataAllowed}, {"menu"}, {"meta", TagFlags::Void}, {"meter"}, {"nav"}, {"nobr"},
+    {"noembed"}, {"noframes"}, {"noscript"}, {"object"}, {"ol"}, {"optgroup", TagFlags::OptionalEnd},
+    {"option", TagFlags::OptionalEnd}, {"output"}, {"p", TagFlags::OptionalEnd}, {"param", TagFlags::Void},
+    {"picture"}, {"plaintext", TagFlags::RawText}, {"pre", TagFlags::RawText}, {"progress"}, {"q"},
+    {"rp", TagFlags::OptionalEnd}, {"rt", TagFlags::OptionalEnd}, {"ruby"}, {"s"}, {"samp", TagFlags::RawText},
+    {"script", TagFlags::RawText}, {"search"}, {"section"}, {"select"}, {"slot"}, {"small"},
+    {"source", TagFlags::Void}, {"span"}, {"strike"}, {"strong"}, {"style", TagFlags::RawText}, {"sub"},
+    {"summary"}, {"sup"}, {"svg", TagFlags::CdataAllowed}, {"table"}, {"tbody", TagFlags::OptionalEnd},
+    {"td", TagFlags::OptionalEnd}, {"template"}, {"textarea", TagFlags::RawText},
+    {"tfoot", TagFlags::OptionalEnd}, {"th", TagFlags::OptionalEnd}, {"thead", TagFlags::OptionalEnd},
+    {"time"}, {"title"}, {"tr", TagFlags::OptionalEnd}, {"track", TagFlags::Void}, {"tt"}, {"u"}, {"ul"},
+    {"var", TagFlags::RawText}, {"video"}, {"wbr", TagFlags::Void}, {"xmp"},
+};
+
+inline constexpr TagId known_tag_count = sizeof(known_tags) / sizeof(known_tags[0]);
+static_assert(known_tag_count < 256, "Perfect hash slots store ids as uint8_t");
+
+constexpr char to_lower_ascii(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+constexpr bool equals_ignore_case(const std::string_view a, const std::string_view b)
+{
+    if(a.size() != b.size())
+        return false;
+    for(size_t i = 0; i < a.size(); i++) {
+        if(to_lower_ascii(a[i]) != to_lower_ascii(b[i]))
+            return false;
+    }
+    return true;
+}
+
+constexpr uint32_t hash_tag_name(const std::string_view name, uint32_t seed)
+{
+    uint32_t hash = seed ^ uint32_t(name.size());
+    for(char c : name)
+        hash = (hash ^ uint8_t(to_lower_ascii(c))) * 16777619u;
+    return hash ^ (hash >> 15);
+}
+
+struct TagHashTable
+{
+    static constexpr size_t slot_count = 2048;
+    uint32_t seed = 0;
+    std::array<uint8_t, slot_count> slots = {};
+    size_t max_name_size = 0;
+};
+
+/**
+ * @brief Search for a seed that maps every known tag name to its own slot
+*/
+constexpr TagHashTable build_tag_hash_table()
+{
+    for(uint32_t seed = 1;; seed++) {
+        TagHashTable table;
+        table.seed = seed;
+        bool collision = false;
+        for(TagId id = 1; id < known_tag_count && collision == false; id++) {
+            auto& slot = table.slots[hash_tag_name(known_tags[id].name, seed) % TagHashTable::slot_count];
+            collision = slot != 0;
+            slot = uint8_t(id);
+            table.max_name_size = std::max(table.max_name_size, known_tags[id].name.size());
+        }
+        if(collision == false)
+            return table;
+    }
+}
+
+inline constexpr TagHashTable tag_hash_table = build_tag_hash_table();
+
+/**
+ * @brief Look up a known element by name, ignoring case
+ * @return The id of the element, 0 if it is not a known element
+*/
+constexpr TagId find_known_tag(const std::string_view name)
+{
+    if(name.empty() || name.size() > tag_hash_table.max_name_size)
+        return 0;
+    TagId id = tag_hash_table.slots[hash_tag_name(name, tag_hash_table.seed) % TagHashTable::slot_count];
+    if(id == 0 || equals_ignore_case(known_tags[id].name, name) == false)
+        return 0;
+    return id;
+}
+
+inline constexpr TagId doctype_tag = find_known_tag("!DOCTYPE");
+inline constexpr TagId audio_tag = find_known_tag("audio");
+inline constexpr TagId video_tag = find_known_tag("video");
+inline constexpr TagId style_tag = find_known_tag("style");
+inline constexpr TagId script_tag = find_known_tag("script");
+static_assert(doctype_tag != 0 && find_known_tag("DiV") == find_known_tag("div") && find_known_tag("nope") == 0);
+
+constexpr uint8_t tag_flags(TagId id)
+{
+    return id < known_tag_count ? known_tags[id].flags : 0;
+}
+
+constexpr bool has_flag(TagId id, uint8_t flag)
+{
+    return (tag_flags(id) & flag) != 0;
+}
+
+constexpr uint8_t heading_level(TagId id)
+{
+    return id < known_tag_count ? known_tags[id].heading_level : 0;
+}
+
+/**
+ * @brief Maps tag names to Tags. Known elements resolve through the perfect hash, anything else is lowercased and
+ * interned so it also compares by id
+*/
+class TagInterner
+{
+public:
+    explicit TagInterner(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : custom_names(resource), custom_ids(resource), lowered(resource)
+    {
+    }
+
+    /**
+     * @brief Get the tag for `name`, interning it if it is not known yet
+    */
+    Tag intern(const std::string_view name)
+    {
+        if(auto known = find_known_tag(name); known != 0)
+            return {known, known_tags[known].name};
+        lowercase(name);
+        if(auto it = custom_ids.find(lowered); it != custom_ids.end())
+            return {it->second, it->first};
+        TagId id = TagId(known_tag_count + custom_names.size());
+        const std::pmr::string& stored = custom_names.emplace_back(lowered);
+        custom_ids.emplace(stored, id);
+        return {id, stored};
+    }
+
+    /**
+     * @brief Get the tag for `name` without interning it
+     * @return A tag with id 0 if `name` was never interned
+    */
+    Tag find(const std::string_view name)
+    {
+        if(auto known = find_known_tag(name); known != 0)
+            return {known, known_tags[known].name};
+        lowercase(name);
+        if(auto it = custom_ids.find(lowered); it != custom_ids.end())
+            return {it->second, it->first};
+        return {};
+    }
+
+    /**
+     * @brief Number of interned names that are not known elements
+    */
+    size_t size() const { return custom_names.size(); }
+
+    /**
+     * @brief Forget every interned name. Tags handed out before are no longer valid
+    */
+    void clear()
+    {
+        custom_ids.clear();
+        custom_names.clear();
+    }
+
+private:
+    void lowercase(const std::string_view name)
+    {
+        lowered.resize(name.size());
+        for(size_t i = 0; i < name.size(); i++)
+            lowered[i] = to_lower_ascii(name[i]);
+    }
+
+    // deque so the names never move and the string_views into them stay valid
+    std::pmr::deque<std::pmr::string> custom_names;
+    std::pmr::unordered_map<std::string_view, TagId> custom_ids;
+    std::pmr::string lowered;
+};
+
+/**
+ * @brief TagInterner usable in constant evaluation, where its containers are not available. Names are found by
+ * comparing them one by one, HTML literals have few custom elements
+*/
+class LinearTagInterner
+{
+public:
+    constexpr explicit LinearTagInterner(std::pmr::memory_resource* = nullptr) {}
+    LinearTagInterner(const LinearTagInterner&) = delete;
+    LinearTagInterner& operator=(const LinearTagInterner&) = delete;
+
+    constexpr ~LinearTagInterner()
+    {
+        clear();
+    }
+
+    constexpr Tag intern(const std::string_view name)
+    {
+        if(Tag tag = find(name); tag.id != 0)
+            return tag;
+        // Each name has its own allocation, so the views handed out stay valid when `names` grows
+        names.reserve(names.size() + 1);
+        std::string* stored = new std::string(name.size(), '\0');
+        for(size_t i = 0; i < name.size(); i++)
+            (*stored)[i] = to_lower_ascii(name[i]);
+        names.push_back(stored);
+        return {TagId(known_tag_count + names.size() - 1), *stored};
+    }
+
+    constexpr Tag find(const std::string_view name) const
+    {
+        if(auto known = find_known_tag(name); known != 0)
+            return {known, known_tags[known].name};
+        for(size_t i = 0; i < names.size(); i++) {
+            if(equals_ignore_case(*names[i], name))
+                return {TagId(known_tag_count + i), *names[i]};
+        }
+        return {};
+    }
+
+    constexpr size_t size() const { return names.size(); }
+
+    constexpr void clear()
+    {
+        for(std::string* name : names)
+            delete name;
+        names.clear();
+    }
+
+private:
+    std::vector<std::string*> names;
+};
+
+}
@@ -0,0 +1,175 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+using namespace nanoizepp::detail;
+
+ThreadPool::ThreadPool(size_t worker_count)
+{
+    workers.reserve(worker_count);
+    for(size_t i = 0; i < worker_count; i++)
+        workers.emplace_back([this] { work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+}
+
+ThreadPool& ThreadPool::shared()
+{
+    static ThreadPool pool(resolve_thread_count(0) - 1);
+    return pool;
+}
+
+void ThreadPool::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    wake.notify_one();
+}
+
+void ThreadPool::work()
+{
+    while(true) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock(mutex);
+            wake.wait(lock, [this] { return stopping || jobs.empty() == false; });
+            if(jobs.empty())
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+    }
+}
+
+/**
+ * @brief Range of indices owned by one thread, packed in one word so the owner (taking from the front) and thieves
+ * (taking from the back) can update it with a single compare-exchange
+*/
+class WorkRange
+{
+public:
+    void assign(size_t begin, size_t end) { range.store(pack(begin, end)); }
+
+    bool take_front(size_t& index)
+    {
+        uint64_t current = range.load();
+        while(true) {
+            auto [begin, end] = unpack(current);
+            if(begin >= end)
+                return false;
+            if(range.compare_exchange_weak(current, pack(begin + 1, end))) {
+                index = begin;
+                return true;
+            }
+        }
+    }
+
+    bool take_back(size_t& index)
+    {
+        uint64_t current = range.load();
+        while(true) {
+            auto [begin, end] = unpack(current);
+            if(begin >= end)
+                return false;
+            if(range.compare_exchange_weak(current, pack(begin, end - 1))) {
+                index = end - 1;
+                return true;
+            }
+        }
+    }
+
+private:
+    static uint64_t pack(size_t begin, size_t end) { return (uint64_t(begin) << 32) | uint64_t(end); }
+    static std::pair<size_t, size_t> unpack(uint64_t packed) { return {packed >> 32, packed & 0xFFFFFFFF}; }
+
+    std::atomic<uint64_t> range{0};
+};
+
+void ThreadPool::parallel_for(size_t count, size_t max_threads, const std::function<void(size_t, size_t)>& fn)
+{
+    if(count > 0xFFFFFFFF)
+        throw std::runtime_error("Nanoize++: too many items for parallel_for()");
+
+    // Helpers may only get to run after the caller finished everything, so the state they touch is shared and
+    // `fn` is only called for indices claimed while the caller is still waiting
+    struct State
+    {
+        const std::function<void(size_t, size_t)>* fn;
+        size_t count;
+        std::vector<WorkRange> ranges;
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable all_done;
+        size_t done = 0;
+    };
+    size_t threads = std::max<size_t>(1, std::min({max_threads, count, workers.size() + 1}));
+    auto state = std::make_shared<State>();
+    state->fn = &fn;
+    state->count = count;
+    state->ranges = std::vector<WorkRange>(threads);
+    for(size_t i = 0; i < threads; i++)
+        state->ranges[i].assign(count * i / threads, count * (i + 1) / threads);
+
+    auto run = [](State& state, size_t slot) {
+        auto next = [&](size_t& index) {
+            if(state.ranges[slot].take_front(index))
+                return true;
+            for(size_t i = 1; i < state.ranges.size(); i++) {
+                if(state.ranges[(slot + i) % state.ranges.size()].take_back(index))
+                    return true;
+            }
+            return false;
+        };
+        size_t index;
+        while(next(index)) {
+            if(state.failed == false) {
+                try {
+                    (*state.fn)(index, slot);
+                }
+                catch(...) {
+                    std::lock_guard lock(state.mutex);
+                    if(state.failed.exchange(true) == false)
+                        state.error = std::current_exception();
+                }
+            }
+            std::lock_guard lock(state.mutex);
+            if(++state.done == state.count)
+                state.all_done.notify_all();
+        }
+    };
+
+    for(size_t slot = 1; slot < threads; slot++)
+        submit([state, run, slot] { run(*state, slot); });
+    run(*state, 0);
+
+    std::unique_lock lock(state->mutex);
+    state->all_done.wait(lock, [&] { return state->done == state->count; });
+    if(state->error)
+        std::rethrow_exception(state->error);
+}
+
+size_t nanoizepp::detail::resolve_thread_count(size_t threads)
+{
+    if(threads != 0)
+        return threads;
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
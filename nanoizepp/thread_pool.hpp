@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * @brief Fixed set of worker threads running queued jobs
+*/
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t worker_count);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Pool shared by the whole process, with one worker less than the number of hardware threads since the
+     * calling thread always helps
+    */
+    static ThreadPool& shared();
+
+    size_t worker_count() const { return workers.size(); }
+
+    /**
+     * @brief Call `fn(i, slot)` for every i in [0, count) on at most `max_threads` threads, the calling thread
+     * included, and wait for all of them. `slot` (below `max_threads`) identifies the thread running the call and
+     * can index per-thread scratch data.
+     *
+     * Indices are split into one contiguous range per thread. A thread works through its own range from the front
+     * and steals from the back of the other ranges when it runs out, so callers should order the indices such that
+     * every range gets a similar amount of work, with the largest items first.
+     *
+     * Safe to call from a job running on the pool: the caller alone can complete the whole range. If a call throws,
+     * the remaining indices are skipped and the first exception is rethrown.
+    */
+    void parallel_for(size_t count, size_t max_threads, const std::function<void(size_t, size_t)>& fn);
+
+private:
+    void submit(std::function<void()> job);
+    void work();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+/**
+ * @brief Resolve a thread count option, 0 meaning one per hardware thread
+*/
+size_t resolve_thread_count(size_t threads);
+
+}
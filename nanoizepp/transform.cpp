@@ -0,0 +1,103 @@
+#include "transform.hpp"
+#include "transform_handler.hpp"
+#include "emitter.hpp"
+#include "parser.hpp"
+#include "sink.hpp"
+#include "tags.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace nanoizepp;
+using namespace nanoizepp::detail;
+
+/**
+ * @brief true if `name` can be written as an attribute name
+*/
+static bool is_valid_attribute_name(const std::string_view name)
+{
+    return name.empty() == false && std::none_of(name.begin(), name.end(), [](char c) {
+        return is_attribute_whitespace(c) || c == '"' || c == '\'' || c == '<' || c == '>' || c == '/' || c == '=';
+    });
+}
+
+void StartTag::reset(const std::string_view name)
+{
+    tag_name = name;
+    list.clear();
+    copies.clear();
+}
+
+std::optional<std::string_view> StartTag::attribute(const std::string_view name) const
+{
+    for(const auto& attribute : list) {
+        if(equals_ignore_case(attribute.name, name))
+            return attribute.value;
+    }
+    return std::nullopt;
+}
+
+void StartTag::set_attribute(const std::string_view name, const std::string_view value)
+{
+    if(is_valid_attribute_name(name) == false)
+        throw std::runtime_error("Nanoize++: Invalid attribute name '" + std::string(name) + "'");
+    const std::string_view copied_value = value.empty() ? std::string_view() : copies.emplace_back(value);
+    for(auto& attribute : list) {
+        if(equals_ignore_case(attribute.name, name)) {
+            attribute.value = copied_value;
+            return;
+        }
+    }
+    list.push_back({copies.emplace_back(name), copied_value});
+}
+
+bool StartTag::remove_attribute(const std::string_view name)
+{
+    return std::erase_if(list, [&](const Attribute& attribute) { return equals_ignore_case(attribute.name, name); })
+        != 0;
+}
+
+/**
+ * @brief Minimize `html` into `sink` with the single pass engine, running `transforms` on every element
+*/
+template <typename Sink>
+static void nanoize_transformed(const std::string_view html, Sink& sink, const Options& options,
+    const std::span<Transform* const> transforms)
+{
+    sink.set_max_output(options.max_output);
+    Emitter<Sink> emitter(sink, options);
+    TransformHandler<Sink> handler(emitter, transforms);
+    Parser<TransformHandler<Sink>> parser(handler);
+    parser.set_limits(tree_limits(options));
+    parser.parse(html, true);
+    parser.finish();
+}
+
+std::string nanoizepp::nanoize(const std::string_view html, const Options& options,
+    const std::span<Transform* const> transforms)
+{
+    std::string result;
+    nanoize(html, result, options, transforms);
+    return result;
+}
+
+void nanoizepp::nanoize(const std::string_view html, std::string& out, const Options& options,
+    const std::span<Transform* const> transforms)
+{
+    prepare_output(out, html, options);
+    StringSink sink(out);
+    nanoize_transformed(html, sink, options, transforms);
+}
+
+void nanoizepp::nanoize(const std::string_view html, const std::function<void(std::string_view)>& callback,
+    const Options& options, const std::span<Transform* const> transforms)
+{
+    CallbackSink sink(callback);
+    nanoize_transformed(html, sink, options, transforms);
+    sink.flush();
+}
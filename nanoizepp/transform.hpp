@@ -0,0 +1,130 @@
+#pragma once
+
+#include "nanoizepp.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nanoizepp
+{
+
+namespace detail
+{
+template <typename Sink>
+class TransformHandler;
+}
+
+/**
+ * @brief The start tag of an element, as a Transform sees it before it is written
+ *
+ * Names and values are what the document contains: character references are not decoded. Values set here are
+ * written the same way, so a `&` that does not start a reference should be given as `&amp;`; quotes are added or
+ * escaped as the value needs. Attribute names are compared case-insensitively.
+*/
+class StartTag
+{
+public:
+    struct Attribute
+    {
+        std::string_view name;
+        // Empty for attributes written without a value
+        std::string_view value;
+    };
+
+    /**
+     * @brief The lowercase name of the element
+    */
+    std::string_view name() const { return tag_name; }
+
+    /**
+     * @brief The attributes in the order they are written, valid until the next change
+    */
+    std::span<const Attribute> attributes() const { return list; }
+
+    /**
+     * @brief The value of attribute `name`, nullopt if the element does not have it
+    */
+    std::optional<std::string_view> attribute(std::string_view name) const;
+
+    /**
+     * @brief Set attribute `name`, added after the others if the element does not have it yet. An empty value is
+     * written as a bare attribute. The name and value are copied
+    */
+    void set_attribute(std::string_view name, std::string_view value = {});
+
+    /**
+     * @brief Remove attribute `name`, false if the element does not have it
+    */
+    bool remove_attribute(std::string_view name);
+
+    /**
+     * @brief Remove the attributes `predicate` returns true for
+     * @return The number of attributes removed
+    */
+    template <typename Predicate>
+    size_t remove_attributes_if(Predicate predicate)
+    {
+        return std::erase_if(list, predicate);
+    }
+
+private:
+    template <typename Sink>
+    friend class detail::TransformHandler;
+
+    /**
+     * @brief Start over with the next element, forgetting the copies made for the previous one
+    */
+    void reset(std::string_view name);
+
+    std::string_view tag_name;
+    std::vector<Attribute> list;
+    // Names and values given to set_attribute(), kept until the tag is written. A deque does not move them
+    std::deque<std::string> copies;
+};
+
+/**
+ * @brief A change made to every element of a document while it is minimized
+ *
+ * Rewriting links, adding attributes or stripping them usually takes a parse and a serialization of its own. A
+ * Transform runs inside the minimizer's parse instead: it sees each start tag once, after the parser fixed the
+ * document up and before the minimizer writes it, and what it changes is minimized like the rest.
+*/
+class Transform
+{
+public:
+    virtual ~Transform() = default;
+
+    /**
+     * @brief Called for the start tag of every element in document order, void and raw text elements included. The
+     * DOCTYPE is not an element
+    */
+    virtual void element(StartTag& tag) = 0;
+};
+
+/**
+ * @brief Miniaturize HTML, running `transforms` on every element in the same pass
+ *
+ * The transforms run in the given order, each seeing the changes of the ones before it. Documents are minimized on
+ * the calling thread by the single pass engine: `options.engine` and `options.threads` are ignored.
+*/
+std::string nanoize(std::string_view html, const Options& options, std::span<Transform* const> transforms);
+
+/**
+ * @brief Miniaturize HTML into a caller-owned buffer, running `transforms` on every element in the same pass
+*/
+void nanoize(std::string_view html, std::string& out, const Options& options,
+    std::span<Transform* const> transforms);
+
+/**
+ * @brief Miniaturize HTML, running `transforms` on every element, and hand the output to `callback` in blocks
+*/
+void nanoize(std::string_view html, const std::function<void(std::string_view)>& callback, const Options& options,
+    std::span<Transform* const> transforms);
+
+}
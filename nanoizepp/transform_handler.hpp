@@ -0,0 +1,71 @@
+#pragma once
+
+#include "transform.hpp"
+#include "emitter.hpp"
+#include "parser.hpp"
+#include "tags.hpp"
+
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace nanoizepp::detail
+{
+
+/**
+ * @brief Parser handler that lets the transforms change each start tag, then passes the document on to an Emitter
+*/
+template <typename Sink>
+class TransformHandler
+{
+public:
+    TransformHandler(Emitter<Sink>& emitter, const std::span<Transform* const> transforms)
+        : emitter(emitter), transforms(transforms)
+    {
+    }
+
+    /**
+     * @brief Run `transforms` on the elements of the next document
+    */
+    void set_transforms(const std::span<Transform* const> transforms) { this->transforms = transforms; }
+
+    void open(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        emitter.open(tag, transform(tag, attributes));
+    }
+
+    void void_element(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        if(tag.id == doctype_tag)
+            emitter.void_element(tag, attributes);
+        else
+            emitter.void_element(tag, transform(tag, attributes));
+    }
+
+    void text(const std::string_view text) { emitter.text(text); }
+    void raw_text(const std::string_view text) { emitter.raw_text(text); }
+    void close(const Tag tag) { emitter.close(tag); }
+
+private:
+    std::span<const Attribute> transform(const Tag tag, const std::span<const Attribute> attributes)
+    {
+        start_tag.reset(tag.name);
+        for(const auto& attribute : attributes)
+            start_tag.list.push_back({attribute.name, attribute.value});
+        for(Transform* transform : transforms)
+            transform->element(start_tag);
+
+        // The quote characters of the document are only needed for template placeholders
+        transformed.clear();
+        for(const auto& attribute : start_tag.list)
+            transformed.push_back({attribute.name, attribute.value});
+        return transformed;
+    }
+
+    Emitter<Sink>& emitter;
+    std::span<Transform* const> transforms;
+    StartTag start_tag;
+    std::vector<Attribute> transformed;
+};
+
+}
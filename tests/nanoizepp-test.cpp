@@ -1,6 +1,24 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <nanoizepp/nanoizepp.hpp>
+#include <nanoizepp/coroutine.hpp>
+#include <nanoizepp/scan.hpp>
+#include <nanoizepp/static_html.hpp>
+#include <nanoizepp/tags.hpp>
+#include <nanoizepp/transform.hpp>
+#ifdef NANOIZEPP_HAS_ZLIB
+#include <nanoizepp/compress.hpp>
+#include <zlib.h>
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
 
 TEST_CASE("BASIC HTML", "[nanoizepp-test]")
 {
@@ -66,6 +84,17 @@ TEST_CASE("Duplicated attributes", "[nanoizepp-test]")
     std::string html = R"(<p class="red" class="blue">123</p>)";
     std::string miniaturized = nanoizepp::nanoize(html);
     CHECK(miniaturized == "<p class=\"red\">123</p>");
+
+    // Tags with many attributes find duplicates through a hash table
+    html = "<p";
+    std::string expected = "<p";
+    for(int i = 0; i < 100; i++) {
+        html += " a" + std::to_string(i) + "=\"" + std::to_string(i) + "\" a" + std::to_string(i / 2) + "=x";
+        expected += " a" + std::to_string(i) + "=\"" + std::to_string(i) + "\"";
+    }
+    html += " a0 a99>x</p>";
+    miniaturized = nanoizepp::nanoize(html);
+    CHECK(miniaturized == expected + ">x</p>");
 }
 
 TEST_CASE("EOF before tag name", "[nanoizepp-test]")
@@ -77,6 +106,11 @@ TEST_CASE("EOF before tag name", "[nanoizepp-test]")
     html = "</";
     miniaturized = nanoizepp::nanoize(html);
     CHECK(miniaturized == "</");
+
+    // Not tags either
+    html = "a <> b<[c";
+    miniaturized = nanoizepp::nanoize(html);
+    CHECK(miniaturized == html);
 }
 
 TEST_CASE("Incorrectly closed comments", "[nanoizepp-test]")
@@ -84,6 +118,11 @@ TEST_CASE("Incorrectly closed comments", "[nanoizepp-test]")
     std::string html = "<!-- Hello World --!>";
     std::string miniaturized = nanoizepp::nanoize(html);
     CHECK(miniaturized == "");
+
+    // Whichever end comes first closes the comment
+    html = "<!-- a --!><p>b</p><!-- c -->";
+    miniaturized = nanoizepp::nanoize(html);
+    CHECK(miniaturized == "<p>b</p>");
 }
 
 TEST_CASE("End tag with tailing solidus")
@@ -115,7 +154,267 @@ TEST_CASE("missing-attribute-value")
 {
     std::string html = R"(<p class>123</p>)";
     std::string miniaturized = nanoizepp::nanoize(html);
-    CHECK(miniaturized == "<p>123</p>");
+    CHECK(miniaturized == "<p class>123</p>");
+}
+
+TEST_CASE("Attribute quotes")
+{
+    CHECK(nanoizepp::nanoize(R"(<p title='a "b" c' id='x'>1</p>)") == R"(<p title='a "b" c' id="x">1</p>)");
+    CHECK(nanoizepp::nanoize(R"(<p title='a > b'>1</p>)") == R"(<p title="a > b">1</p>)");
+    // With both, the rarer one is escaped
+    CHECK(nanoizepp::nanoize(R"(<p title=a"b'c"d>1</p>)") == R"(<p title='a"b&#39;c"d'>1</p>)");
+    CHECK(nanoizepp::nanoize(R"(<p title=a'b"c'd>1</p>)") == R"(<p title="a'b&quot;c'd">1</p>)");
+}
+
+TEST_CASE("Attribute minification")
+{
+    nanoizepp::Options options;
+    options.minify_attributes = true;
+    auto check = [&](const std::string& html, const std::string& expected) {
+        INFO(html);
+        CHECK(nanoizepp::nanoize(html, options) == expected);
+        nanoizepp::Options tree = options;
+        tree.engine = nanoizepp::Engine::Tree;
+        CHECK(nanoizepp::nanoize(html, tree) == expected);
+    };
+
+    check(R"(<input type="checkbox" checked="checked" disabled="" name="a" value="x y">)",
+        R"(<input type=checkbox checked disabled name=a value="x y">)");
+    check(R"(<div class="  a   b
+        c " id="main" title="" data-x="a=b" data-y="`x`" data-z="it's">x</div>)",
+        R"(<div class="a b c" id=main title data-x="a=b" data-y="`x`" data-z="it's">x</div>)");
+    check(R"(<p class=" one ">x</p>)", R"(<p class=one>x</p>)");
+    // Defaults are removed where they are defaults
+    check(R"(<script type="text/javascript" async="async" src="a.js"></script>)", R"(<script async src=a.js></script>)");
+    check(R"(<style type="TEXT/CSS">a{}</style><link rel="stylesheet" type="text/css" href="a.css">)",
+        R"(<style>a{}</style><link rel=stylesheet href=a.css>)");
+    check(R"(<form method="GET" enctype="application/x-www-form-urlencoded" action="/s"></form>)",
+        R"(<form action=/s></form>)");
+    check(R"(<form method="post"></form><table><tr><td colspan="1" rowspan="2">x</td></tr></table>)",
+        R"(<form method=post></form><table><tr><td rowspan=2>x</td></tr></table>)");
+    check(R"(<input type="text"><button type="submit">x</button>)", R"(<input type=text><button type=submit>x</button>)");
+    // Only on the elements where the attribute means that
+    check(R"(<div checked="checked" method="get"></div><x-y disabled="disabled"></x-y>)",
+        R"(<div checked=checked method=get></div><x-y disabled=disabled></x-y>)");
+    // The style attribute keeps quotes even when minified empty
+    nanoizepp::Options css = options;
+    css.minify_css = true;
+    CHECK(nanoizepp::nanoize(R"(<p style="/* x */" class="a">x</p>)", css) == R"(<p style="" class=a>x</p>)");
+}
+
+TEST_CASE("Character reference shortening")
+{
+    nanoizepp::Options options;
+    options.minify_entities = true;
+    auto check = [&](const std::string& html, const std::string& expected) {
+        INFO(html);
+        CHECK(nanoizepp::nanoize(html, options) == expected);
+        nanoizepp::Options tree = options;
+        tree.engine = nanoizepp::Engine::Tree;
+        CHECK(nanoizepp::nanoize(html, tree) == expected);
+    };
+
+    // Characters that are safe as they are become UTF-8
+    check("<p>a&nbsp;b&#x000A0;c&#160;&eacute;&#x1F600;</p>", "<p>a\u00A0b\u00A0c\u00A0\u00E9\U0001F600</p>");
+    check("<p>&#39;&quot;&gt;&#x3c;&LT;&amp;</p>", "<p>'\">&lt;&lt;&amp;</p>");
+    // The others get their shortest reference
+    check("<p>&#x41;&#10;&NewLine;&semi;&#x23;&equals;</p>", "<p>&#65;&#10;&#10;&#59;&num;&#61;</p>");
+    check("<p>&nvlt;&fjlig;</p>", "<p>&lt;\u20D2&#102;&#106;</p>");
+    // An ampersand stays escaped where it could start a reference
+    check("<p>&amp; &amp;copy; &amp;#38; &amp;&lt;</p>", "<p>& &amp;copy; &amp;#38; &&lt;</p>");
+    // References without ';' and the ones browsers do not decode to themselves are left alone
+    check("<p>&copy 2024 &#0; &#x80; &#xD800; &#x110000; &#xFFFF; &bogus; &# &#x;</p>",
+        "<p>&copy 2024 &#0; &#x80; &#xD800; &#x110000; &#xFFFF; &bogus; &# &#x;</p>");
+
+    // Attribute values are quoted for what they contain once decoded
+    check(R"(<a title="caf&eacute;" href="?a=1&amp;b=2&amp;c">x</a>)",
+        R"(<a title="café" href="?a=1&amp;b=2&amp;c">x</a>)");
+    check(R"(<a title="&quot;hi&quot;">x</a><a title="&#39;&quot;&quot;">y</a>)",
+        R"(<a title='"hi"'>x</a><a title='&#39;""'>y</a>)");
+    check(R"(<a title='"&#39;'>x</a>)", R"(<a title="&#34;'">x</a>)");
+    check(R"(<a title="&lt;b&gt;">x</a>)", R"(<a title="<b>">x</a>)");
+    nanoizepp::Options unquoted = options;
+    unquoted.minify_attributes = true;
+    CHECK(nanoizepp::nanoize(R"(<a title="caf&eacute;" alt="a&#32;b" id="&lt;b&gt;">x</a>)", unquoted)
+        == R"(<a title=café alt=a&#32;b id="<b>">x</a>)");
+
+    // Raw text and CDATA sections are not decoded
+    check("<script>a&amp;&amp;b</script><svg><![CDATA[&amp;]]></svg>",
+        "<script>a&amp;&amp;b</script><svg><![CDATA[&amp;]]></svg>");
+    CHECK(nanoizepp::nanoize("<p title=\"&eacute;\">&nbsp;</p>") == "<p title=\"&eacute;\">&nbsp;</p>");
+}
+
+TEST_CASE("Template placeholders")
+{
+    nanoizepp::Options options;
+    options.minify_attributes = true;
+    options.minify_css = true;
+    options.minify_js = true;
+    auto check = [&](const std::string& html, const std::string& expected) {
+        INFO(html);
+        CHECK(nanoizepp::nanoize_template(html, options) == expected);
+        nanoizepp::Options tree = options;
+        tree.engine = nanoizepp::Engine::Tree;
+        CHECK(nanoizepp::nanoize_template(html, tree) == expected);
+    };
+
+    // Placeholders are kept byte for byte, with the text around them
+    check("<p>Hello,   {{ name }}  !</p>", "<p>Hello, {{ name }} !</p>");
+    check("<ul>\n  {% for item in items %}\n  <li>{% if a < b and c > \"d\" %}x{% endif %}</li>\n  {% endfor %}\n</ul>",
+        "<ul> {% for item in items %} <li>{% if a < b and c > \"d\" %}x{% endif %}</li> {% endfor %} </ul>");
+    check("<%c++ for(auto& x : xs) { %>\n<li>[[ x ]]</li>\n<%c++ } %>",
+        "<%c++ for(auto& x : xs) { %> <li>[[ x ]]</li> <%c++ } %>");
+    check("<p>a</p><!-- {{ dropped }} -->{# kept #}", "<p>a</p>{# kept #}");
+    // Attribute values that contain one keep their quotes, or get some
+    check(R"(<a href={{ url }} title='{{ t|default("x") }}' class="  a  {{ c }} ">x</a>)",
+        R"(<a href="{{ url }}" title='{{ t|default("x") }}' class="a {{ c }}">x</a>)");
+    check(R"(<input {{ attrs }} type="text" disabled="{{ d }}"><{{ tag }} class="a">x</{{ tag }}>)",
+        R"(<input {{ attrs }} type=text disabled="{{ d }}"><{{ tag }} class=a>x</{{ tag }}>)");
+    check(R"(<script type="{{ t }}" async="{{ a }}"></script><td colspan="{{ n }}" rowspan="1"></td>)",
+        R"(<script type="{{ t }}" async="{{ a }}"></script><td colspan="{{ n }}"></td>)");
+    check(R"(<p style="color: {{ c }} ; margin: 0px">x</p><p style="margin: 0px">y</p>)",
+        R"(<p style="color: {{ c }} ; margin: 0px">x</p><p style="margin:0">y</p>)");
+    // Scripts that contain a placeholder are not minified
+    check("<script>var x = {{ data|tojson }};  // c\n</script><script>var y = 1;  // c\n</script>",
+        "<script>var x = {{ data|tojson }};  // c\n</script><script>var y=1;</script>");
+
+    // nanoize() takes them for markup
+    CHECK(nanoizepp::nanoize("<p>{% if a < b %}x{% endif %}</p>") != "<p>{% if a < b %}x{% endif %}</p>");
+
+    // Custom delimiters, the longest opening delimiter wins
+    std::vector<nanoizepp::Placeholder> custom{{"${", "}"}, {"$", "$"}, {"${{", "}}"}};
+    CHECK(nanoizepp::nanoize_template("<p>${ a }  ${{ b } }}  $ c $ {{ d</p>", {}, custom)
+        == "<p>${ a } ${{ b } }} $ c $ {{ d</p>");
+    CHECK(nanoizepp::nanoize_template("<p>  a  </p>", {}, {}) == nanoizepp::nanoize("<p>  a  </p>"));
+
+    CHECK_THROWS_AS(nanoizepp::nanoize_template("<p>{{ a </p>"), std::runtime_error);
+    CHECK_THROWS_AS(nanoizepp::nanoize_template("<p>\x1A</p>"), std::runtime_error);
+    std::vector<nanoizepp::Placeholder> empty{{"{{", ""}};
+    CHECK_THROWS_AS(nanoizepp::nanoize_template("<p></p>", {}, empty), std::runtime_error);
+}
+
+TEST_CASE("Transforms")
+{
+    struct CdnLinks : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override
+        {
+            for(std::string_view name : {"src", "href"}) {
+                if(auto url = tag.attribute(name); url && url->starts_with("/static/"))
+                    tag.set_attribute(name, "https://cdn.example.com" + std::string(*url));
+            }
+        }
+    };
+    struct ScriptNonce : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override
+        {
+            if(tag.name() == "script")
+                tag.set_attribute("nonce", "r4nd0m");
+        }
+    };
+    struct LazyImages : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override
+        {
+            if(tag.name() == "img" && tag.attribute("loading").has_value() == false)
+                tag.set_attribute("loading", "lazy");
+        }
+    };
+    struct StripTracking : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override
+        {
+            tag.remove_attributes_if([](const nanoizepp::StartTag::Attribute& attribute) {
+                return attribute.name.starts_with("data-track");
+            });
+            tag.remove_attribute("ping");
+        }
+    };
+    struct Names : nanoizepp::Transform
+    {
+        std::string seen;
+        void element(nanoizepp::StartTag& tag) override { seen += std::string(tag.name()) + " "; }
+    };
+
+    CdnLinks cdn;
+    ScriptNonce nonce;
+    LazyImages lazy;
+    StripTracking strip;
+    std::array<nanoizepp::Transform*, 4> transforms{&cdn, &nonce, &lazy, &strip};
+    nanoizepp::Options options;
+    CHECK(nanoizepp::nanoize(R"(<a href="/static/a.pdf" data-track-id="1" ping="/t">a</a>
+        <img src="/static/a.png"><img loading=eager data-tracking src="https://x.org/b.png">
+        <script src="/static/app.js"></script><script>var a = 1;</script>)", options, transforms)
+        == R"(<a href="https://cdn.example.com/static/a.pdf">a</a><img src="https://cdn.example.com/static/a.png" )"
+        R"(loading="lazy"><img loading="eager" src="https://x.org/b.png"><script )"
+        R"(src="https://cdn.example.com/static/app.js" nonce="r4nd0m"></script><script nonce="r4nd0m">var a = 1;)"
+        R"(</script>)");
+
+    // What the transforms set is minimized like the rest
+    options.minify_attributes = true;
+    options.minify_js = true;
+    CHECK(nanoizepp::nanoize("<img src='/static/a b.png' ><script type=\"text/javascript\">var a = 1;</script>",
+        options, transforms)
+        == "<img src=\"https://cdn.example.com/static/a b.png\" loading=lazy><script nonce=r4nd0m>var a=1;</script>");
+
+    // Transforms run in order and see the document after the parser fixed it up: the DOCTYPE is not an element
+    Names before;
+    Names after;
+    std::array<nanoizepp::Transform*, 3> ordered{&before, &lazy, &after};
+    std::string out;
+    nanoizepp::nanoize("<!DOCTYPE html><My-Element><IMG>", out, {}, ordered);
+    CHECK(out == "<!DOCTYPE html><my-element><img loading=\"lazy\"></my-element>");
+    CHECK(before.seen == "my-element img ");
+    CHECK(after.seen == before.seen);
+
+    // Values are written as given, with the quotes they need
+    struct Quoted : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override
+        {
+            tag.set_attribute("title", "say \"hi\"");
+            tag.set_attribute("HIDDEN");
+            CHECK(tag.remove_attribute("missing") == false);
+        }
+    };
+    Quoted quoted;
+    std::array<nanoizepp::Transform*, 1> one{&quoted};
+    CHECK(nanoizepp::nanoize("<p hidden=hidden>x</p>", {}, one) == "<p hidden title='say \"hi\"'>x</p>");
+
+    struct Invalid : nanoizepp::Transform
+    {
+        void element(nanoizepp::StartTag& tag) override { tag.set_attribute("a b", "c"); }
+    };
+    Invalid invalid;
+    std::array<nanoizepp::Transform*, 1> broken{&invalid};
+    CHECK_THROWS_AS(nanoizepp::nanoize("<p>x</p>", {}, broken), std::runtime_error);
+
+    // The other outputs run the same transforms
+    const std::string links = "<a href=/static/a.pdf data-track=1>a</a><img src=/static/b.png><script>x()</script>";
+    const std::string expected = nanoizepp::nanoize(links, options, transforms);
+    std::string streamed;
+    nanoizepp::nanoize(links, [&](std::string_view block) { streamed += block; }, options, transforms);
+    CHECK(streamed == expected);
+    nanoizepp::Minimizer minimizer(options);
+    CHECK(minimizer.nanoize(links, transforms) == expected);
+    CHECK(minimizer.nanoize(links) == nanoizepp::nanoize(links, options));
+    CHECK(minimizer.nanoize(links, transforms) == expected);
+    CHECK_THROWS_AS(minimizer.nanoize("<p>x</p>", broken), std::runtime_error);
+    CHECK(minimizer.nanoize(links, ordered) == nanoizepp::nanoize(links, options, ordered));
+
+    // Without transforms, the output is nanoize()'s
+    std::string page = "<html><body>\n  <p class=' a  b '>Hello   &amp; <b>world</b></p>\n</body></html>";
+    CHECK(nanoizepp::nanoize(page, options, std::span<nanoizepp::Transform* const>()) == nanoizepp::nanoize(page,
+        options));
+}
+
+TEST_CASE("Attributes keep their order")
+{
+    std::string html = R"(<a target="_blank" href="https://example.com" class="x">link</a>)";
+    std::string miniaturized = nanoizepp::nanoize(html);
+    CHECK(miniaturized == html);
+    CHECK(nanoizepp::nanoize(html, nanoizepp::Options{.engine = nanoizepp::Engine::Tree}) == html);
 }
 
 TEST_CASE("missing-whitespace-between-attributes")
@@ -161,7 +460,7 @@ TEST_CASE("unexpected-character-after-attribute-name")
 {
     std::string html = R"(<div id=></div>)";
     std::string miniaturized = nanoizepp::nanoize(html);
-    CHECK(miniaturized == "<div></div>");
+    CHECK(miniaturized == "<div id></div>");
 }
 
 TEST_CASE("unexpected-question-mark-instead-of-tag-name")
@@ -275,15 +574,19 @@ TEST_CASE("Empty attributes")
 {
     std::string html = R"(<div attr1></div>)";
     std::string miniaturized = nanoizepp::nanoize(html);
-    CHECK(miniaturized == "<div></div>");
+    CHECK(miniaturized == "<div attr1></div>");
 
-    html = R"(<div attr1 attr2></div>)";
+    html = R"(<div attr1 attr2=""></div>)";
     miniaturized = nanoizepp::nanoize(html);
-    CHECK(miniaturized == "<div></div>");
+    CHECK(miniaturized == "<div attr1 attr2></div>");
 
     html = R"(<div "attr1"></div>)";
     miniaturized = nanoizepp::nanoize(html);
-    CHECK(miniaturized == "<div></div>");
+    CHECK(miniaturized == "<div \"attr1\"></div>");
+
+    // Boolean attributes are kept
+    html = R"(<input type="checkbox" checked disabled><script async defer src="a.js"></script>)";
+    CHECK(nanoizepp::nanoize(html) == html);
 }
 
 TEST_CASE("HTML5 Only")
@@ -341,3 +644,936 @@ TEST_CASE("media_element")
     auto miniaturized = nanoizepp::nanoize(html);
     CHECK(miniaturized == "<audio controls></audio>");
 }
+
+TEST_CASE("Tag names are case-insensitive")
+{
+    CHECK(nanoizepp::nanoize("<DIV>Hello</div>") == "<div>Hello</div>");
+    CHECK(nanoizepp::nanoize("<div><P>Hello</p></DIV>") == "<div><p>Hello</p></div>");
+    CHECK(nanoizepp::nanoize("<my-Element>Hello</MY-ELEMENT><p>x</p>") == "<my-element>Hello</my-element><p>x</p>");
+    CHECK(nanoizepp::nanoize("<BR/><Img src=\"a.png\">") == "<br><img src=\"a.png\">");
+    CHECK(nanoizepp::nanoize("<!doctype HTML><p>x</p>") == "<!DOCTYPE html><p>x</p>");
+    CHECK(nanoizepp::nanoize("<SCRIPT> if(a < b) f() </Script><p>x</p>") == "<script> if(a < b) f() </script><p>x</p>");
+    CHECK(nanoizepp::nanoize("<SVG><![CDATA[<]]></svg>") == "<svg><![CDATA[<]]></svg>");
+    CHECK(nanoizepp::nanoize("<H1>Title</h2>text") == "<h1>Title</h1>text");
+}
+
+TEST_CASE("Raw text ends like in browsers")
+{
+    // Whitespace, a solidus or attributes may follow the name of the end tag
+    CHECK(nanoizepp::nanoize("<script>a()</SCRIPT ><p>x</p>") == "<script>a()</script><p>x</p>");
+    CHECK(nanoizepp::nanoize("<style>a{}</style\n\t><p>x</p>") == "<style>a{}</style><p>x</p>");
+    CHECK(nanoizepp::nanoize("<textarea> a </textarea/><p>x</p>") == "<textarea> a </textarea><p>x</p>");
+    CHECK(nanoizepp::nanoize("<script>a()</script foo=\"bar\"><p>x</p>") == "<script>a()</script><p>x</p>");
+    // A longer name does not end it
+    CHECK(nanoizepp::nanoize("<script>\"</scripts>\"</script>") == "<script>\"</scripts>\"</script>");
+    CHECK(nanoizepp::nanoize("<script>\"</scrip\"</script>") == "<script>\"</scrip\"</script>");
+
+    // Split anywhere in the end tag when streaming
+    std::string html = "<p>a</p><script>let a = 1;</SCRIPT\t ><p>b</p>";
+    for(size_t cut = 0; cut <= html.size(); cut++) {
+        nanoizepp::StreamNanoizer stream;
+        std::string output = stream.feed(html.substr(0, cut));
+        output += stream.feed(std::string_view(html).substr(cut));
+        output += stream.finish();
+        CHECK(output == "<p>a</p><script>let a = 1;</script><p>b</p>");
+    }
+
+    using namespace nanoizepp::detail;
+    for(TagId id = 1; id < known_tag_count; id++) {
+        std::string upper(known_tags[id].name);
+        for(char& c : upper)
+            c = (char)std::toupper((unsigned char)c);
+        CHECK(find_known_tag(known_tags[id].name) == id);
+        CHECK(find_known_tag(upper) == id);
+    }
+    CHECK(find_known_tag("my-element") == 0);
+    CHECK(find_known_tag("") == 0);
+}
+
+static const std::string test_documents[] = {
+    "<!DOCTYPE html><html><head><title>Test</title></head><body><h1>Test</h1><p>Test</p></body></html>",
+    "\n<!DOCTYPE html>\n<html>\n<head>\n    <title>Test</title>\n</head>\n<body>\n    <h1>Test</h1>\n</body>\n</html>\n",
+    "<p>Hello               world   </p>   and   some   trailing   text   ",
+    "<p><!-- <!-- --> --></p><!--> <!---> <!-- Hello World --!> <! Hello World>",
+    "<div class=\"a\"     id=b / data-x = \"1 > 2\"><p>123</p class=\"red\"><p/>123</p></div>",
+    "<pre>    <div class=\"main_disp\"     ></div></pre><script> if(a < b) alert(\"</p>\") </script>",
+    "<math><![CDATA[<]]></math><p>123<![CDATA[456]]>789</p>",
+    "<p><div></p></div><42></42><?xml version=\"1.0\"?><audio controls></audio>",
+    std::string("text with a NUL \0 inside", 24),
+    "<p>unterminated <!-- comment",
+    "<script>never closed",
+    "<div id=",
+};
+
+static std::string nanoize_in_chunks(std::string_view html, size_t chunk_size, size_t indent = 0, bool newline = false)
+{
+    nanoizepp::StreamNanoizer stream(indent, newline);
+    std::string result;
+    for(size_t i = 0; i < html.size(); i += chunk_size)
+        result += stream.feed(html.substr(i, chunk_size));
+    result += stream.finish();
+    return result;
+}
+
+TEST_CASE("CSS minification")
+{
+    nanoizepp::Options options;
+    options.minify_css = true;
+    auto check = [&](const std::string& html, const std::string& expected) {
+        INFO(html);
+        CHECK(nanoizepp::nanoize(html, options) == expected);
+        nanoizepp::Options tree = options;
+        tree.engine = nanoizepp::Engine::Tree;
+        CHECK(nanoizepp::nanoize(html, tree) == expected);
+        nanoizepp::StreamNanoizer stream(options);
+        std::string streamed;
+        for(size_t i = 0; i < html.size(); i += 7)
+            streamed += stream.feed(std::string_view(html).substr(i, 7));
+        streamed += stream.finish();
+        CHECK(streamed == expected);
+    };
+
+    // Off by default
+    std::string style = "<style>\n  body {\n    margin : 0px ;\n  }\n</style>";
+    CHECK(nanoizepp::nanoize(style) == style);
+
+    check(style, "<style>body{margin:0}</style>");
+    check("<style>a:hover , a:focus > b { padding: 0px 10px 0em; color: #FFAA00 } /* x */ p{x:y;;}</style>",
+        "<style>a:hover,a:focus > b{padding:0 10px 0;color:#FA0}p{x:y}</style>");
+    check("<p style=\" color : red ; margin : 0px ; \">x</p>", "<p style=\"color:red;margin:0\">x</p>");
+    // Licenses, strings and URLs are kept
+    check("<style>a{background:url( a b.png ) #aabbccdd;content:\"  a ; b  \"}/*! license */</style>",
+        "<style>a{background:url( a b.png ) #abcd;content:\"  a ; b  \"}/*! license */</style>");
+    // Zero lengths keep their unit where a unitless 0 means something else or is invalid
+    check("<style>a{width:calc(100% - 0px);flex:1 0px;transition:opacity 0s;transform:rotate(0deg);margin:10px 0.5em}</style>",
+        "<style>a{width:calc(100% - 0px);flex:1 0px;transition:opacity 0s;transform:rotate(0deg);margin:10px 0.5em}</style>");
+    check("<style>a{--gap:  0px #aabbcc}</style>", "<style>a{--gap:0px #aabbcc}</style>");
+    // Selectors are not values, nested ones included
+    check("<style>#aabbcc{color:#aabbcc}a:not(#ffffff) {x:y} .a{ .b:hover #aabbcc{x:y} } div :is(p){x:y}</style>",
+        "<style>#aabbcc{color:#abc}a:not(#ffffff){x:y}.a{.b:hover #aabbcc{x:y}}div :is(p){x:y}</style>");
+    check("<style>@media (min-width: 0px) and (max-width: 1px) { a { margin: 0px } }</style>",
+        "<style>@media (min-width: 0px) and (max-width: 1px){a{margin:0}}</style>");
+    // Character references are not decoded, such attributes are left alone
+    check("<p style=\"content: &quot;a&quot; ;\">x</p>", "<p style=\"content: &quot;a&quot; ;\">x</p>");
+    check("<style type=\"text/less\">a { b: 0px }</style>", "<style type=\"text/less\">a { b: 0px }</style>");
+}
+
+TEST_CASE("JavaScript compaction")
+{
+    nanoizepp::Options options;
+    options.minify_js = true;
+    auto check = [&](const std::string& html, const std::string& expected) {
+        INFO(html);
+        CHECK(nanoizepp::nanoize(html, options) == expected);
+        nanoizepp::Options tree = options;
+        tree.engine = nanoizepp::Engine::Tree;
+        CHECK(nanoizepp::nanoize(html, tree) == expected);
+        nanoizepp::StreamNanoizer stream(options);
+        std::string streamed;
+        for(size_t i = 0; i < html.size(); i += 5)
+            streamed += stream.feed(std::string_view(html).substr(i, 5));
+        streamed += stream.finish();
+        CHECK(streamed == expected);
+    };
+    auto unchanged = [&](const std::string& html) { check(html, html); };
+
+    // Off by default
+    std::string script = "<script>\n  var a = 1; // one\n</script>";
+    CHECK(nanoizepp::nanoize(script) == script);
+
+    check(script, "<script>var a=1;</script>");
+    check("<script>\n  var a = 1 ,  b = a + +c - -d ; /* sum */\n  f ( a ,\n b ) ;\n</script>",
+        "<script>var a=1,b=a+ +c- -d;f(a,b);</script>");
+    // Strings, templates and regular expressions are copied as they are
+    check("<script>s = \"a  // b\" + 'c  /* d */' ;</script>", "<script>s=\"a  // b\"+'c  /* d */';</script>");
+    check("<script>t = `a  ${ { x : 1 }.x + `b  ${ c }` }  d` ;</script>",
+        "<script>t=`a  ${{x:1}.x+`b  ${c}`}  d`;</script>");
+    check("<script>r = /[/]\\/  x/g.test( s ) ; if ( a ) /b  c/.test(s) ; x = a / 2 / b ;</script>",
+        "<script>r=/[/]\\/  x/g.test(s);if(a)/b  c/.test(s);x=a/2/b;</script>");
+    check("<script>e = typeof /re/ ; c = a.return / 2 / 3 ; d = 1 .toString() ; f = /a/ in x</script>",
+        "<script>e=typeof/re/;c=a.return/2/3;d=1 .toString();f=/a/ in x</script>");
+    check("<script>/*! license  */\nvar a</script>", "<script>/*! license  */\nvar a</script>");
+    // Line breaks that automatic semicolon insertion may depend on are kept
+    check("<script>\n  x = y\n  (z)\n  return\n  a\n  i++\n  /* many\n lines */ j\n</script>",
+        "<script>x=y\n(z)\nreturn\na\ni++\nj</script>");
+    check("<script>x = y +\n  z\n; f(a\n, b\n)</script>", "<script>x=y+z;f(a,b)</script>");
+    // Scripts that do not tokenize or that are not JavaScript are left alone
+    unchanged("<script>var x = \"unterminated\n  ;</script>");
+    unchanged("<script><!--\n  a  =  1\n//--></script>");
+    unchanged("<script type=\"text/template\">  <b>  x  </b>  </script>");
+    unchanged("<script type=\"text/javascript; charset=utf-8\">  x  =  1  </script>");
+    unchanged("<script src=\"a.js\">  x  =  1  </script>");
+    check("<script type=\"module\">import  { a }  from  \"./a.js\" ;</script>",
+        "<script type=\"module\">import{a}from\"./a.js\";</script>");
+    // JSON blocks only lose their whitespace
+    check("<script type=\"application/ld+json\">\n{ \"a\" : [ 1, 2 , \"x  y\" ],\n  \"b\" : true }\n</script>",
+        "<script type=\"application/ld+json\">{\"a\":[1,2,\"x  y\"],\"b\":true}</script>");
+    check("<script type=importmap>{ \"imports\" : { \"a\" : \"./a.js\" } }</script>",
+        "<script type=\"importmap\">{\"imports\":{\"a\":\"./a.js\"}}</script>");
+}
+
+TEST_CASE("Streaming matches nanoize")
+{
+    for(const auto& html : test_documents) {
+        auto expected = nanoizepp::nanoize(html);
+        auto expected_indented = nanoizepp::nanoize(html, 2, true);
+        for(size_t chunk_size = 1; chunk_size <= html.size(); chunk_size++) {
+            CHECK(nanoize_in_chunks(html, chunk_size) == expected);
+            CHECK(nanoize_in_chunks(html, chunk_size, 2, true) == expected_indented);
+        }
+    }
+}
+
+TEST_CASE("Streaming emits output before the end of the document")
+{
+    nanoizepp::StreamNanoizer stream;
+    CHECK(stream.feed("<html><body><p>Hello   ") == "<html><body><p>Hello");
+    CHECK(stream.feed("  world</p><!-- a comment") == " world</p>");
+    CHECK(stream.feed(" --><script>let a = 1;") == "");
+    CHECK(stream.feed("</script>") == "<script>let a = 1;</script>");
+    CHECK(stream.finish() == "</body></html>");
+}
+
+TEST_CASE("Chunked minimization with a coroutine")
+{
+    nanoizepp::Options indented{.indent = 2, .newline = true};
+    for(const auto& html : test_documents) {
+        for(size_t chunk_size : {1, 7, 64, 4096}) {
+            for(const auto& options : {nanoizepp::Options{}, indented}) {
+                std::string output;
+                for(std::string_view chunk : nanoizepp::nanoize_chunks(html, options, chunk_size)) {
+                    CHECK(chunk.size() <= chunk_size);
+                    CHECK(chunk.empty() == false);
+                    output += chunk;
+                }
+                CHECK(output == nanoizepp::nanoize(html, options));
+            }
+        }
+    }
+
+    // Nothing is minimized before it is pulled, and a generator can be dropped half way
+    std::string page = "<ul>";
+    for(int i = 0; i < 1000; i++)
+        page += "<li>item   " + std::to_string(i) + "</li>";
+    auto chunks = nanoizepp::nanoize_chunks(page, {}, 256);
+    REQUIRE(chunks.next());
+    CHECK(chunks.chunk().starts_with("<ul><li>item 0</li>"));
+    CHECK(chunks.chunk().size() <= 256);
+    REQUIRE(chunks.next());
+    auto moved = std::move(chunks);
+    CHECK(chunks.next() == false);
+    CHECK(moved.next());
+}
+
+TEST_CASE("Single pass and tree engines produce identical output")
+{
+    for(const auto& html : test_documents) {
+        for(auto [indent, newline] : {std::pair<size_t, bool>{0, false}, {0, true}, {4, false}, {2, true}}) {
+            nanoizepp::Options tree{indent, newline, nanoizepp::Engine::Tree};
+            nanoizepp::Options single_pass{indent, newline, nanoizepp::Engine::SinglePass};
+            CHECK(nanoizepp::nanoize(html, single_pass) == nanoizepp::nanoize(html, tree));
+        }
+    }
+}
+
+TEST_CASE("Parallel minimization matches sequential")
+{
+    // Large documents made of pieces that put the cuts between segments inside comments, raw text, CDATA and tags,
+    // and elements that are closed several segments after they were opened
+    const std::string pieces[] = {
+        "<div class=\"a\"><p>Hello   <b>world</b></p>\n",
+        "</div>",
+        "<!-- a comment with <div> and </p> tags inside, long enough to cross a cut ",
+        "-->",
+        "<script>if(a < b) document.write(\"</div><p>\")</script>",
+        "<svg><![CDATA[ <p> ]]></svg>",
+        "<ul><li>one<li>two</ul>",
+        "<h1>Title</h3>",
+        "<custom-Element data-x=\"<a href=x>\">text</CUSTOM-element>",
+        "<table><tr><td>1</td><td>2</td></tr>",
+        "</table>",
+        "<pre>  keep   <b>this</b>  </pre>",
+        "   \n\t  ",
+    };
+    std::mt19937 random(42);
+    for(int round = 0; round < 3; round++) {
+        std::string html;
+        while(html.size() < 2 * 1024 * 1024) {
+            const auto& piece = pieces[random() % std::size(pieces)];
+            // Blow up comments so they span whole segments
+            if(piece.starts_with("<!--") && random() % 64 == 0)
+                html += piece + std::string(300 * 1024, 'x');
+            else
+                html += piece;
+        }
+        for(auto [indent, newline] : {std::pair<size_t, bool>{0, false}, {2, true}}) {
+            nanoizepp::Options sequential{indent, newline};
+            nanoizepp::Options parallel{indent, newline};
+            parallel.threads = 4;
+            CHECK(nanoizepp::nanoize(html, parallel) == nanoizepp::nanoize(html, sequential));
+        }
+    }
+
+    std::string big_script = "<p>x</p><script>" + std::string(3 * 1024 * 1024, 'a') + "<div></script><p>y</p>";
+    CHECK(nanoizepp::nanoize(big_script, nanoizepp::Options{.threads = 8}) == nanoizepp::nanoize(big_script));
+
+    std::string deep;
+    for(int i = 0; i < 200000; i++)
+        deep += "<div>x";
+    CHECK(nanoizepp::nanoize(deep, nanoizepp::Options{.threads = 8}) == nanoizepp::nanoize(deep));
+
+    std::string unterminated = "<div>" + std::string(1024 * 1024, ' ') + "<!-- never closed <p>" + std::string(1024 * 1024, 'x');
+    CHECK(nanoizepp::nanoize(unterminated, nanoizepp::Options{.threads = 8}) == nanoizepp::nanoize(unterminated));
+
+    std::string bad_doctype = "<p>" + std::string(1024 * 1024, 'x') + "<!DOCTYPE html4>" + std::string(1024 * 1024, 'x');
+    CHECK_THROWS(nanoizepp::nanoize(bad_doctype, nanoizepp::Options{.threads = 8}));
+    std::string hidden_doctype = "<!--" + std::string(1024 * 1024, 'x') + "<!DOCTYPE html4>" + std::string(1024 * 1024, 'x') + "-->";
+    CHECK_NOTHROW(nanoizepp::nanoize(hidden_doctype, nanoizepp::Options{.threads = 8}));
+}
+
+template <nanoizepp::detail::FixedString html, nanoizepp::Options options = nanoizepp::Options{}>
+static void check_static_html()
+{
+    INFO(html.view());
+    CHECK(nanoizepp::static_html<html, options> == nanoizepp::nanoize(html.view(), options));
+}
+
+TEST_CASE("Compile time minimization")
+{
+    constexpr std::string_view page = nanoizepp::static_html<R"(
+        <!DOCTYPE html>
+        <html>
+            <head><title>Not   found</title><!-- layout shell --></head>
+            <body><p>The page   is gone</p></body>
+        </html>)">;
+    static_assert(page == "<!DOCTYPE html><html><head><title>Not found</title></head><body><p>The page is gone</p>"
+        "</body></html>");
+    static_assert(nanoizepp::static_html<"">.empty() && nanoizepp::static_html<"">.data()[0] == '\0');
+    // Whitespace runs longer than a vector, between tags and inside tags and text
+    static_assert(nanoizepp::static_html<R"(<div>
+                    <p   class="a"                    id="b">deeply                        indented</p>
+                                        </div>)"> == "<div><p class=\"a\" id=\"b\">deeply indented</p></div>");
+
+    check_static_html<"<p>Hello               world   </p>   and   some   trailing   text   ">();
+    check_static_html<"<p><!-- <!-- --> --></p><!--> <!---> <!-- Hello World --!> <! Hello World>">();
+    check_static_html<"<div class=\"a\"     id=b / data-x = \"1 > 2\"><p>123</p class=\"red\"><p/>123</p></div>">();
+    check_static_html<"<pre>    <div></div></pre><script> if(a < b) alert(\"</p>\") </SCRIPT ></p>">();
+    check_static_html<"<math><![CDATA[<]]></math><p>123<![CDATA[456]]>789</p><p><div></p></div><42></42><?x?>">();
+    check_static_html<"<h1>Title</h3><custom-Element a=\"1\" a=\"2\">text</CUSTOM-element><br/><x-y/>">();
+    check_static_html<"<p>unterminated <!-- comment">();
+    check_static_html<"<div title='a \"b\"' id=x><p>x</div>", nanoizepp::Options{.indent = 2, .newline = true}>();
+    check_static_html<"<input type=\"checkbox\" checked=\"checked\" class=\" a  b \">",
+        nanoizepp::Options{.minify_attributes = true}>();
+    check_static_html<"<p title=\"caf&eacute;\">&nbsp;&#x3C;</p>", nanoizepp::Options{.minify_entities = true}>();
+
+    // The compile time minimizer also runs at run time, which compares it on many more documents
+    for(const auto& html : test_documents)
+        CHECK(nanoizepp::detail::nanoize_constexpr(html) == nanoizepp::nanoize(html));
+    const std::string pieces[] = {"<div>", "</div>", "<p>", "</p>", "<h2>", "</h4>", "<x-Y a=1>", "</X-y>", "<br/>",
+        "<svg>", "</svg>", "<![CDATA[ x ]]>", "<!--", "-->", "<!x>", "<?x>", "<script>", "</script>", "<pre>",
+        "</pre >", " text ", "\n\t", "&amp;", "<", ">", "</", "<5>", "<img src=a alt='b' alt=c>", "< b>", "\"", "'",
+        "<td colspan=1>"};
+    std::mt19937 random(7);
+    for(int round = 0; round < 500; round++) {
+        std::string html;
+        size_t count = random() % 40;
+        for(size_t i = 0; i < count; i++)
+            html += pieces[random() % std::size(pieces)];
+        INFO(html);
+        for(const auto& options : {nanoizepp::Options{}, nanoizepp::Options{.indent = 1, .newline = true},
+                nanoizepp::Options{.minify_attributes = true, .minify_entities = true}})
+            CHECK(nanoizepp::detail::nanoize_constexpr(html, options) == nanoizepp::nanoize(html, options));
+    }
+}
+
+TEST_CASE("Batch minimization")
+{
+    std::vector<std::string> owned(std::begin(test_documents), std::end(test_documents));
+    owned.push_back(std::string(200 * 1024, ' ') + "<p>a large document</p>");
+    owned.push_back("");
+    std::vector<std::string_view> documents(owned.begin(), owned.end());
+
+    auto results = nanoizepp::nanoize_batch(documents, nanoizepp::Options{.indent = 2}, 4);
+    REQUIRE(results.size() == documents.size());
+    for(size_t i = 0; i < documents.size(); i++)
+        CHECK(results[i] == nanoizepp::nanoize(documents[i], 2));
+
+    std::vector<std::string> outputs(documents.size());
+    auto stats = nanoizepp::nanoize_batch(documents, outputs);
+    size_t input_bytes = 0, output_bytes = 0;
+    for(size_t i = 0; i < documents.size(); i++) {
+        CHECK(outputs[i] == nanoizepp::nanoize(documents[i]));
+        input_bytes += documents[i].size();
+        output_bytes += outputs[i].size();
+    }
+    CHECK(stats.documents == documents.size());
+    CHECK(stats.input_bytes == input_bytes);
+    CHECK(stats.output_bytes == output_bytes);
+    CHECK(stats.threads >= 1);
+
+    std::vector<std::string> collected(documents.size());
+    std::mutex mutex;
+    nanoizepp::nanoize_batch(documents, [&](size_t index, std::string_view output) {
+        std::lock_guard lock(mutex);
+        collected[index] = output;
+    });
+    CHECK(collected == outputs);
+
+    std::vector<std::string> too_few(1);
+    CHECK_THROWS(nanoizepp::nanoize_batch(documents, too_few));
+    std::vector<std::string_view> invalid = {"<p>ok</p>", "<!DOCTYPE html4>"};
+    CHECK_THROWS(nanoizepp::nanoize_batch(invalid));
+}
+
+TEST_CASE("Output into caller-owned buffers")
+{
+    for(const auto& html : test_documents) {
+        auto expected = nanoizepp::nanoize(html);
+
+        std::string buffer = "previous content";
+        nanoizepp::nanoize(html, buffer);
+        CHECK(buffer == expected);
+
+        std::vector<char> vec;
+        nanoizepp::nanoize(html, vec);
+        CHECK(std::string(vec.begin(), vec.end()) == expected);
+
+        std::string from_callback;
+        nanoizepp::nanoize(html, [&](std::string_view block) { from_callback += block; });
+        CHECK(from_callback == expected);
+
+        std::string from_iterator;
+        nanoizepp::nanoize(html, std::back_inserter(from_iterator));
+        CHECK(from_iterator == expected);
+    }
+
+    // Reusing a buffer keeps its capacity
+    std::string buffer;
+    nanoizepp::nanoize(test_documents[0], buffer);
+    auto capacity = buffer.capacity();
+    auto data = buffer.data();
+    nanoizepp::nanoize(test_documents[0], buffer);
+    CHECK(buffer.capacity() == capacity);
+    CHECK(buffer.data() == data);
+}
+
+#ifdef NANOIZEPP_HAS_ZLIB
+/**
+ * @brief Decompress gzip or zlib data
+*/
+static std::string inflate_all(std::string_view compressed)
+{
+    z_stream stream{};
+    // 32 detects the gzip and zlib headers
+    REQUIRE(inflateInit2(&stream, 15 + 32) == Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+    stream.avail_in = uInt(compressed.size());
+    std::string out;
+    int result = Z_OK;
+    while(result == Z_OK) {
+        char block[4096];
+        stream.next_out = reinterpret_cast<Bytef*>(block);
+        stream.avail_out = sizeof(block);
+        result = inflate(&stream, Z_NO_FLUSH);
+        out.append(block, sizeof(block) - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    CHECK(result == Z_STREAM_END);
+    CHECK(stream.avail_in == 0);
+    return out;
+}
+
+TEST_CASE("Compressed output")
+{
+    nanoizepp::Options options;
+    options.minify_css = true;
+    for(const auto& html : test_documents) {
+        auto expected = nanoizepp::nanoize(html, options);
+
+        std::string gzip = "previous content";
+        nanoizepp::nanoize_compressed(html, gzip, options);
+        CHECK(gzip.starts_with("\x1f\x8b"));
+        CHECK(inflate_all(gzip) == expected);
+
+        std::string deflate;
+        size_t blocks = 0;
+        nanoizepp::nanoize_compressed(html, [&](std::string_view block) {
+            deflate += block;
+            blocks++;
+        }, options, {.format = nanoizepp::CompressionFormat::Deflate, .level = 9});
+        CHECK(inflate_all(deflate) == expected);
+        CHECK(blocks >= 1);
+    }
+
+    // A large document comes out in several blocks, and compresses
+    std::string html;
+    while(html.size() < 4 * 1024 * 1024)
+        html += "<div class=\"row\">\n    <p>Row " + std::to_string(html.size()) + "</p>\n</div>\n";
+    size_t blocks = 0;
+    std::string compressed;
+    nanoizepp::nanoize_compressed(html, [&](std::string_view block) {
+        compressed += block;
+        blocks++;
+    });
+    CHECK(blocks > 1);
+    CHECK(compressed.size() < html.size() / 4);
+    CHECK(inflate_all(compressed) == nanoizepp::nanoize(html));
+
+    // A compressor is reused after finish(), and flush() makes everything written so far decodable
+    nanoizepp::Compressor compressor;
+    for(int i = 0; i < 2; i++) {
+        std::string stream;
+        auto append = [&](std::string_view block) { stream += block; };
+        nanoizepp::StreamNanoizer nanoizer;
+        compressor.write(nanoizer.feed("<p>  Hello  "), append);
+        compressor.flush(append);
+        CHECK(stream.empty() == false);
+        compressor.write(nanoizer.feed(" world </p>"), append);
+        compressor.write(nanoizer.finish(), append);
+        compressor.finish(append);
+        CHECK(inflate_all(stream) == nanoizepp::nanoize("<p>  Hello   world </p>"));
+    }
+}
+#endif
+
+/**
+ * @brief Memory resource counting the allocations that reach it
+*/
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST_CASE("Reusable minimizer")
+{
+    for(auto engine : {nanoizepp::Engine::SinglePass, nanoizepp::Engine::Tree}) {
+        for(auto [indent, newline] : {std::pair<size_t, bool>{0, false}, {2, true}}) {
+            nanoizepp::Options options{.indent = indent, .newline = newline, .engine = engine};
+            CountingResource resource;
+            nanoizepp::Minimizer minimizer(options, &resource);
+            std::string out;
+            out.reserve(4096);
+            std::pmr::string pmr_out;
+            pmr_out.reserve(4096);
+            for(const auto& html : test_documents) {
+                auto expected = nanoizepp::nanoize(html, options);
+                CHECK(minimizer.nanoize(html) == expected);
+                // Caller-owned buffers are written directly, the minimizer's own buffer is left alone
+                minimizer.nanoize(html, out);
+                CHECK(out == expected);
+                minimizer.nanoize(html, pmr_out);
+                CHECK(std::string_view(pmr_out) == expected);
+            }
+
+            // Warmed up on every document, going through them again does not allocate
+            size_t allocations = resource.allocations;
+            for(const auto& html : test_documents) {
+                minimizer.nanoize(html, out);
+                CHECK(out == nanoizepp::nanoize(html, options));
+                minimizer.nanoize(html, pmr_out);
+                CHECK(minimizer.nanoize(html) == out);
+            }
+            CHECK(resource.allocations == allocations);
+        }
+    }
+
+    // A document that throws leaves the minimizer usable
+    nanoizepp::Minimizer minimizer;
+    CHECK_THROWS(minimizer.nanoize("<!DOCTYPE svg><div><p>unclosed"));
+    CHECK(minimizer.nanoize("<p>a</p>") == "<p>a</p>");
+}
+
+TEST_CASE("Document statistics")
+{
+    const std::string html = "<!-- c1 --><div class=\"a\" id=\"b\"><p>one   two</p><span>x</div> </h2>"
+        "<![CDATA[x]]><?pi?><svg><![CDATA[y]]></svg>";
+    for(auto engine : {nanoizepp::Engine::SinglePass, nanoizepp::Engine::Tree}) {
+        nanoizepp::Options options{.engine = engine};
+        nanoizepp::DocumentStats stats;
+        std::string out;
+        nanoizepp::nanoize(html, out, options, stats);
+        CHECK(out == nanoizepp::nanoize(html));
+
+        CHECK(stats.input_bytes == html.size());
+        CHECK(stats.output_bytes == out.size());
+        CHECK(stats.elements == 4);
+        CHECK(stats.attributes == 2);
+        CHECK(stats.text_nodes == 3);
+        CHECK(stats.comments_removed == 2);
+        CHECK(stats.cdata_removed == 1);
+        CHECK(stats.whitespace_removed == 3);
+        // <span> closed by </div>, <div> by the end of the document
+        CHECK(stats.implied_end_tags == 2);
+        CHECK(stats.ignored_end_tags == 1);
+        CHECK(stats.allocations > 0);
+        CHECK(stats.total_time >= stats.parse_time + stats.serialize_time);
+
+        // A minimizer reports the same, without allocating once warmed up
+        nanoizepp::Minimizer minimizer(options);
+        nanoizepp::DocumentStats reused;
+        CHECK(minimizer.nanoize(html, reused) == out);
+        CHECK(minimizer.nanoize(html, reused) == out);
+        CHECK(reused.elements == stats.elements);
+        CHECK(reused.implied_end_tags == stats.implied_end_tags);
+        CHECK(reused.whitespace_removed == stats.whitespace_removed);
+        CHECK(reused.allocations == 0);
+        CHECK(minimizer.nanoize(html) == out);
+    }
+}
+
+TEST_CASE("Memory resource overloads")
+{
+    std::array<std::byte, 64 * 1024> storage;
+    for(const auto& html : test_documents) {
+        std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(), std::pmr::null_memory_resource());
+        auto expected = nanoizepp::nanoize(html);
+        std::pmr::string minimized = nanoizepp::nanoize(html, &arena);
+        CHECK(std::string_view(minimized) == expected);
+        CHECK(minimized.get_allocator().resource() == &arena);
+
+        CountingResource resource;
+        std::pmr::string out("previous content", &resource);
+        nanoizepp::nanoize(html, out, nanoizepp::Options{.engine = nanoizepp::Engine::Tree});
+        CHECK(std::string_view(out) == expected);
+        // Scratch memory came from the same resource
+        CHECK(resource.allocations > 1);
+    }
+}
+
+TEST_CASE("Scan kernels agree with std::string_view")
+{
+    using namespace nanoizepp::detail;
+    const CharSet sets[] = {whitespace_chars, CharSet(" \t\n\r=>"), CharSet("<"), CharSet("abcdefgh")};
+    // The kernels do not look past max_size characters
+    CHECK_THROWS(CharSet(""));
+    CHECK_THROWS(CharSet("abcdefghi"));
+    const char alphabet[] = " \t\n\r=><abcxyz\0\xff";
+    std::mt19937 rng(42);
+    std::vector<std::string> inputs;
+    for(size_t size = 0; size < 100; size++) {
+        for(int i = 0; i < 20; i++) {
+            std::string input;
+            // Long runs of the same class, like real text
+            while(input.size() < size)
+                input.append(rng() % 40 + 1, alphabet[rng() % (sizeof(alphabet) - 1)]);
+            input.resize(size);
+            inputs.push_back(input);
+        }
+    }
+
+    auto initial = current_scan_kernel();
+    for(auto kernel : available_scan_kernels()) {
+        CHECK(set_scan_kernel(kernel));
+        for(const auto& set : sets) {
+            std::string_view chars(set.chars.data(), set.size);
+            for(const auto& input : inputs) {
+                std::string_view sv = input;
+                CHECK(scan_first_of(sv, set) == sv.find_first_of(chars));
+                CHECK(scan_first_not_of(sv, set) == sv.find_first_not_of(chars));
+            }
+        }
+        for(const auto& input : inputs) {
+            size_t expected = std::string_view::npos;
+            for(size_t i = 0; i < input.size() && expected == std::string_view::npos; i++) {
+                bool next_is_space = i + 1 < input.size() && whitespace_chars.contains(input[i + 1]);
+                if(input[i] == '\0' || (input[i] == ' ' && next_is_space) || (input[i] != ' ' && whitespace_chars.contains(input[i])))
+                    expected = i;
+            }
+            CHECK(scan_text_rewrite(input) == expected);
+        }
+        // Same output whatever the kernel
+        for(const auto& html : test_documents)
+            CHECK(nanoizepp::nanoize(html) == nanoizepp::nanoize(html, nanoizepp::Options{.engine = nanoizepp::Engine::Tree}));
+    }
+    set_scan_kernel(initial);
+}
+
+static std::string repeat(std::string_view piece, size_t size)
+{
+    std::string result;
+    result.reserve(size + piece.size());
+    while(result.size() < size)
+        result += piece;
+    return result;
+}
+
+TEST_CASE("Cache of minimized documents")
+{
+    const std::string html = "<html> <body> <p>Hello <b>world</b></p> </body> </html>";
+
+    SECTION("Hits share the cached buffer") {
+        nanoizepp::NanoizeCache cache(1 << 20);
+        auto first = cache.nanoize(html);
+        auto second = cache.nanoize(html);
+        CHECK(*first == nanoizepp::nanoize(html));
+        CHECK(first == second);
+        CHECK(cache.find(html) == first);
+        CHECK(cache.find("<p>other</p>") == nullptr);
+
+        auto stats = cache.stats();
+        CHECK(stats.hits == 1);
+        CHECK(stats.misses == 1);
+        CHECK(stats.entries == 1);
+        CHECK(stats.bytes == first->size());
+
+        cache.clear();
+        CHECK(cache.find(html) == nullptr);
+        CHECK(cache.stats().entries == 0);
+        // Buffers handed out stay valid
+        CHECK(*first == nanoizepp::nanoize(html));
+    }
+
+    SECTION("Output options are part of the key") {
+        nanoizepp::NanoizeCache cache(1 << 20);
+        auto compact = cache.nanoize(html);
+        auto indented = cache.nanoize(html, nanoizepp::Options{.indent = 2, .newline = true});
+        CHECK(compact != indented);
+        CHECK(*indented == nanoizepp::nanoize(html, 2, true));
+        // The engine does not change the output
+        CHECK(cache.nanoize(html, nanoizepp::Options{.engine = nanoizepp::Engine::Tree}) == compact);
+        CHECK(cache.stats().entries == 2);
+    }
+
+    SECTION("Memory budget is enforced") {
+        const size_t budget = 16 * 1024;
+        nanoizepp::NanoizeCache cache(budget, 1);
+        for(int i = 0; i < 1000; i++)
+            cache.nanoize("<p>document " + std::to_string(i) + "</p>");
+        auto stats = cache.stats();
+        CHECK(stats.misses == 1000);
+        CHECK(stats.evictions > 0);
+        CHECK(stats.entries + stats.evictions == 1000);
+        CHECK(stats.bytes <= budget);
+
+        // A document larger than the budget is minimized but not cached
+        std::string big = "<p>" + std::string(budget * 2, 'x') + "</p>";
+        CHECK(*cache.nanoize(big) == nanoizepp::nanoize(big));
+        CHECK(cache.find(big) == nullptr);
+    }
+
+    SECTION("Limits apply to hits") {
+        nanoizepp::NanoizeCache cache(1 << 20);
+        auto unlimited = cache.nanoize(html);
+        CHECK_THROWS_AS(cache.nanoize(html, nanoizepp::Options{.max_output = 10}), nanoizepp::LimitExceeded);
+        CHECK_THROWS_AS(cache.find(html, nanoizepp::Options{.max_output = 10}), nanoizepp::LimitExceeded);
+        CHECK_THROWS_AS(cache.nanoize(html, nanoizepp::Options{.max_depth = 2}), nanoizepp::LimitExceeded);
+        CHECK_THROWS_AS(cache.nanoize(html, nanoizepp::Options{.max_nodes = 3}), nanoizepp::LimitExceeded);
+        CHECK(cache.stats().entries == 1);
+
+        // Limits the document is within still get the cached output, or one cached for them
+        CHECK(cache.nanoize(html, nanoizepp::Options{.max_output = unlimited->size()}) == unlimited);
+        auto limited = cache.nanoize(html, nanoizepp::Options{.max_depth = 16, .max_nodes = 100});
+        CHECK(*limited == *unlimited);
+        CHECK(cache.nanoize(html, nanoizepp::Options{.max_depth = 16, .max_nodes = 100}) == limited);
+    }
+
+    SECTION("Shards are never too small for a page") {
+        nanoizepp::NanoizeCache cache(8 << 20, 64);
+        std::string page = "<p>" + repeat("<b>cached</b> ", 200 * 1024) + "</p>";
+        auto first = cache.nanoize(page);
+        CHECK(cache.nanoize(page) == first);
+        CHECK(cache.stats().hits == 1);
+        CHECK(cache.stats().entries == 1);
+    }
+
+    SECTION("Recently used entries survive eviction") {
+        nanoizepp::NanoizeCache cache(16 * 1024, 1);
+        auto hot = cache.nanoize(html);
+        for(int i = 0; i < 1000; i++) {
+            cache.nanoize(html);
+            cache.nanoize("<p>document " + std::to_string(i) + "</p>");
+        }
+        CHECK(cache.find(html) == hot);
+    }
+
+    SECTION("Concurrent use") {
+        nanoizepp::NanoizeCache cache(64 * 1024, 4);
+        std::vector<std::thread> threads;
+        std::atomic<size_t> wrong{0};
+        for(int t = 0; t < 8; t++) {
+            threads.emplace_back([&, t] {
+                for(int i = 0; i < 2000; i++) {
+                    std::string document = "<div> <p>" + std::to_string((i * 7 + t) % 300) + "</p> </div>";
+                    if(*cache.nanoize(document) != nanoizepp::nanoize(document))
+                        wrong++;
+                }
+            });
+        }
+        for(auto& thread : threads)
+            thread.join();
+        CHECK(wrong == 0);
+        auto stats = cache.stats();
+        CHECK(stats.hits + stats.misses == 16000);
+        CHECK(stats.bytes <= 64 * 1024);
+    }
+}
+
+// Best of three, in nanoseconds per input byte
+template <typename Function>
+static double nanoseconds_per_byte(size_t bytes, Function&& function)
+{
+    double best = 1e300;
+    for(int i = 0; i < 3; i++) {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / double(bytes));
+    }
+    return best;
+}
+
+/**
+ * @brief The limit `html` exceeds with `options`, if any
+*/
+static std::optional<nanoizepp::Limit> exceeded_limit(const std::string& html, const nanoizepp::Options& options)
+{
+    try {
+        nanoizepp::nanoize(html, options);
+    }
+    catch(const nanoizepp::LimitExceeded& error) {
+        return error.limit();
+    }
+    return std::nullopt;
+}
+
+TEST_CASE("Limits on untrusted documents")
+{
+    for(auto engine : {nanoizepp::Engine::SinglePass, nanoizepp::Engine::Tree}) {
+        INFO(int(engine));
+        nanoizepp::Options options;
+        options.engine = engine;
+        const std::string nested = "<div><p><b>x</b></p></div>";
+
+        options.max_depth = 3;
+        CHECK(nanoizepp::nanoize(nested, options) == nested);
+        options.max_depth = 2;
+        CHECK(exceeded_limit(nested, options) == nanoizepp::Limit::Depth);
+        // Flattened, the innermost element is closed to make room
+        options.flatten_deep_nesting = true;
+        CHECK(nanoizepp::nanoize(nested, options) == "<div><p></p><b>x</b></div>");
+        options.max_depth = 1;
+        CHECK(nanoizepp::nanoize(repeat("<div>", 5 * 100000), options) == repeat("<div></div>", 11 * 100000));
+        CHECK(nanoizepp::nanoize("<div><div><div>x</div></div></div>", options)
+            == "<div></div><div></div><div>x</div>");
+        options.max_depth = 0;
+
+        // Elements, raw text elements and text nodes count
+        options.max_nodes = 5;
+        CHECK(nanoizepp::nanoize("<p>a</p><br><script>x</script>", options) == "<p>a</p><br><script>x</script>");
+        CHECK(exceeded_limit("<p>a</p><p>b</p><br><br>", options) == nanoizepp::Limit::Nodes);
+        options.max_nodes = 0;
+
+        options.max_output = 18;
+        CHECK(nanoizepp::nanoize("<p>hello   world</p>", options) == "<p>hello world</p>");
+        CHECK(exceeded_limit("<p>hello wide world</p>", options) == nanoizepp::Limit::Output);
+        // Indentation makes the output grow with depth times the number of elements
+        options.max_output = 1024 * 1024;
+        options.indent = 4;
+        CHECK(exceeded_limit(repeat("<div>", 5 * 3000), options) == nanoizepp::Limit::Output);
+    }
+
+    nanoizepp::Options options;
+    options.max_output = 8;
+    std::string callback_output;
+    CHECK_THROWS_AS(nanoizepp::nanoize("<p>too long</p>", [&](std::string_view block) { callback_output += block; },
+        options), nanoizepp::LimitExceeded);
+    // The output is not reserved past the limit
+    std::string limited_output;
+    CHECK_THROWS_AS(nanoizepp::nanoize(repeat("<p>a</p>", 100000), limited_output, options), nanoizepp::LimitExceeded);
+    CHECK(limited_output.capacity() < 64);
+    // Templates are limited with their placeholders put back
+    options.max_output = 20;
+    CHECK_THROWS_AS(nanoizepp::nanoize_template("<p>{{ a very long placeholder name here }}</p>", options),
+        nanoizepp::LimitExceeded);
+    CHECK(nanoizepp::nanoize_template("<p>{{ short }}</p>", options) == "<p>{{ short }}</p>");
+    options.max_output = 8;
+    nanoizepp::StreamNanoizer stream(options);
+    // The limit is on the whole document, not on each piece
+    CHECK_NOTHROW(stream.feed("<p>a</p>"));
+    CHECK_THROWS_AS([&]() {
+        stream.feed("<p>b</p>");
+        stream.finish();
+    }(), nanoizepp::LimitExceeded);
+
+    // A minimizer is usable again after a document that exceeded a limit
+    options.max_output = 0;
+    options.max_depth = 2;
+    nanoizepp::Minimizer minimizer(options);
+    CHECK_THROWS_AS(minimizer.nanoize("<a><b><i>x</i></b></a>"), nanoizepp::LimitExceeded);
+    CHECK(minimizer.nanoize("<a><b>x</b></a>") == "<a><b>x</b></a>");
+    options.threads = 4;
+    std::string large = repeat("<p>a<b>b</b></p>", 4 * 1024 * 1024);
+    CHECK(nanoizepp::nanoize(large, options) == large);
+}
+
+TEST_CASE("Adversarial input stays linear")
+{
+    // Quadratic behavior on any of these would be thousands of times slower than ordinary HTML of the same size.
+    // The bound is loose enough for sanitizer and debug builds
+    const size_t size = 512 * 1024;
+    const double max_ratio = 50;
+
+    std::string ordinary = repeat("<p>Some <b>bold</b> text and <a href=\"/x\" class=\"link\">a link</a></p>\n", size);
+    double baseline = nanoseconds_per_byte(ordinary.size(), [&]() { nanoizepp::nanoize(ordinary); });
+
+    std::vector<std::pair<std::string, std::string>> inputs = {
+        {"end tags of elements that are not open", repeat("<div>", size / 2) + repeat("</span></x-y></h5>", size / 2)},
+        {"CDATA deep inside elements", repeat("<div>", size / 2) + repeat("<![CDATA[x]]>", size / 2)},
+        {"end tags closing one level each", repeat("<b>", size / 4) + repeat("<i><u></i>", size / 2)},
+        {"many attributes", "<div" + repeat(" a=1 b c=\"\" d=x", size / 2) + [&]() {
+            std::string unique;
+            for(size_t i = 0; unique.size() < size / 2; i++)
+                unique += " a" + std::to_string(i) + "=1";
+            return unique;
+        }() + ">"},
+        {"raw text full of partial end tags", "<script>" + repeat("</scrip</scripT", size) + "</script>"},
+        {"unterminated raw text", "<style>" + repeat("</</style", size)},
+        {"comment full of dashes", "<!--" + repeat("--x--!", size) + "-->"},
+        {"unterminated comment", "<!--" + repeat("-- --!", size)},
+        {"NUL and whitespace heavy text", "<p>" + repeat(std::string_view("a\0 \t\n\0\0  ", 10), size)},
+        {"stray less-than signs", repeat("< a <", size)},
+        {"unterminated CDATA", "<svg>" + repeat("<![CDATA[", size)},
+    };
+    // The tree engine serializes without recursion, any depth fits on the stack
+    inputs.push_back({"deeply nested elements", repeat("<div>", size) + "x" + repeat("</div>", size)});
+    nanoizepp::Options tree;
+    tree.engine = nanoizepp::Engine::Tree;
+    for(const auto& [name, html] : inputs) {
+        INFO(name);
+        double per_byte = nanoseconds_per_byte(html.size(), [&]() { nanoizepp::nanoize(html); });
+        CHECK(per_byte < baseline * max_ratio);
+        std::string output = nanoizepp::nanoize(html, tree);
+        CHECK(output == nanoizepp::nanoize(html));
+    }
+
+    // An unfinished construct fed in small chunks must not be rescanned for every chunk
+    std::string comment = "<p>a</p><!--" + repeat("x", size) + "--><p>b</p>";
+    std::string output;
+    double per_byte = nanoseconds_per_byte(comment.size(), [&]() {
+        nanoizepp::StreamNanoizer stream;
+        output.clear();
+        for(size_t i = 0; i < comment.size(); i += 64)
+            output += stream.feed(std::string_view(comment).substr(i, 64));
+        output += stream.finish();
+    });
+    CHECK(output == "<p>a</p><p>b</p>");
+    CHECK(per_byte < baseline * max_ratio);
+}
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Generate nanoizepp/entities.hpp, the named character reference tables, from Python's html.entities.html5.
+
+Only the references ending with a semicolon are included: they are the only ones nanoizepp decodes.
+
+Usage: tools/generate_entities.py > nanoizepp/entities.hpp
+"""
+
+import html.entities
+import sys
+
+LINE_WIDTH = 110
+ENTRIES_PER_LINE = 4
+
+
+def main():
+    entities = sorted((name[:-1], value) for name, value in html.entities.html5.items() if name.endswith(";"))
+    seconds = sorted({value[1] for _, value in entities if len(value) == 2})
+    second_index = {c: i + 1 for i, c in enumerate(seconds)}
+
+    names = "".join(name for name, _ in entities)
+    assert len(names) < 2**16 and max(len(name) for name, _ in entities) < 2**8 and len(seconds) < 2**8
+
+    # Shortest name of every character that has one. On a tie, lowercase names (&amp; rather than &AMP;) and then the
+    # first in sorted order
+    def preference(index):
+        name = entities[index][0]
+        return (len(name), name != name.lower(), index)
+
+    shortest = {}
+    for index, (name, value) in enumerate(entities):
+        if len(value) != 1:
+            continue
+        known = shortest.get(value)
+        if known is None or preference(index) < preference(known):
+            shortest[value] = index
+
+    out = sys.stdout
+    out.write("#pragma once\n\n")
+    out.write("// Generated by tools/generate_entities.py from Python's html.entities.html5, do not edit\n\n")
+    out.write("#include <cstdint>\n#include <string_view>\n\n")
+    out.write("namespace nanoizepp::detail\n{\n\n")
+
+    out.write("struct NamedEntity\n{\n")
+    out.write("    uint16_t name_offset;\n")
+    out.write("    uint8_t name_length;\n")
+    out.write("    // Index in entity_second_codepoints, 0 if the reference is a single character\n")
+    out.write("    uint8_t second;\n")
+    out.write("    uint32_t codepoint;\n")
+    out.write("};\n\n")
+
+    out.write("struct EntityShortestName\n{\n")
+    out.write("    uint32_t codepoint;\n")
+    out.write("    uint16_t entity;\n")
+    out.write("};\n\n")
+
+    out.write("// Names of the references without the semicolon, concatenated in sorted order\n")
+    out.write("inline constexpr std::string_view entity_names =\n")
+    line = ""
+    for name, _ in entities:
+        if len(line) + len(name) > LINE_WIDTH:
+            out.write('    "%s"\n' % line)
+            line = ""
+        line += name
+    out.write('    "%s"\n' % line)
+    out.write("    ;\n\n")
+
+    out.write("inline constexpr uint32_t entity_second_codepoints[] = {0")
+    for c in seconds:
+        out.write(", 0x%X" % ord(c))
+    out.write("};\n\n")
+
+    out.write("// Sorted by name\n")
+    out.write("inline constexpr NamedEntity named_entities[] = {\n")
+    offset = 0
+    rows = []
+    for name, value in entities:
+        second = second_index[value[1]] if len(value) == 2 else 0
+        rows.append("{%d, %d, %d, 0x%X}" % (offset, len(name), second, ord(value[0])))
+        offset += len(name)
+    for start in range(0, len(rows), ENTRIES_PER_LINE):
+        out.write("    " + ", ".join(rows[start:start + ENTRIES_PER_LINE]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("// The shortest name of every character that has one, sorted by codepoint\n")
+    out.write("inline constexpr EntityShortestName shortest_entity_names[] = {\n")
+    rows = ["{0x%X, %d}" % (ord(c), shortest[c]) for c in sorted(shortest)]
+    for start in range(0, len(rows), ENTRIES_PER_LINE + 2):
+        out.write("    " + ", ".join(rows[start:start + ENTRIES_PER_LINE + 2]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("}\n")
+
+
+if __name__ == "__main__":
+    main()